@@ -0,0 +1,16 @@
+extends RefCounted
+## Helper for C++ logger benchmarks (tests/cpp/benchmarks/).
+## Calls back into C++ from a GDScript frame with local and member variables,
+## so that script backtraces, variables and source context can be captured.
+
+var member_dict: Dictionary = {"name": "benchmark", "values": [1, 2, 3]}
+var member_text: String = "Lorem ipsum dolor sit amet"
+
+
+func run(callback: Callable, iterations: int) -> void:
+	@warning_ignore("unused_variable")
+	var local_array: Array = range(16)
+	@warning_ignore("unused_variable")
+	var local_vector := Vector3(1, 2, 3)
+	for i in iterations:
+		callback.call(i)
@@ -0,0 +1,50 @@
+extends GdUnitTestSuite
+## Test "repeated_error_capacity" error logger limit.
+
+
+signal callback_processed
+
+var _num_events: int = 0
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		# Remember only 2 error sources within a long window.
+		options.godot_logger.limits.repeated_error_capacity = 2
+		options.godot_logger.limits.repeated_error_window_ms = 10000
+		# Make sure other limits are not interfering.
+		options.godot_logger.limits.events_per_frame = 88
+		options.godot_logger.limits.throttle_events = 88
+		options.before_send = _before_send
+	)
+
+
+func _before_send(ev: SentryEvent) -> SentryEvent:
+	if ev.is_crash():
+		# Likely processing previous crash.
+		return ev
+	_num_events += 1
+	callback_processed.emit()
+	return null
+
+
+## Repeated error should be suppressed while remembered, and captured again once evicted by other errors.
+func test_repeated_error_capacity_limit() -> void:
+	# Wait for special startup limits to expire.
+	while Engine.get_process_frames() < 10:
+		await get_tree().process_frame
+
+	monitor_signals(self, false)
+
+	push_error("error-a")
+	push_error("error-b")
+	push_error("error-a") # suppressed
+	await assert_signal(self).is_emitted("callback_processed")
+	await get_tree().create_timer(0.1).timeout
+	assert_int(_num_events).is_equal(2)
+
+	push_error("error-c") # evicts "error-a"
+	push_error("error-a")
+	await assert_signal(self).is_emitted("callback_processed")
+	await get_tree().create_timer(0.1).timeout
+	assert_int(_num_events).is_equal(4)
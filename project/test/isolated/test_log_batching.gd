@@ -0,0 +1,46 @@
+extends GdUnitTestSuite
+## Structured logs should be sent in batches when "log_batch_interval_ms" is set.
+
+
+signal batch_processed
+
+var _bodies: PackedStringArray
+var _batch_frames: Array[int]
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.log_batch_interval_ms = 50
+		options.log_batch_size = 3
+		options.before_send_log = _before_send_log
+	)
+
+
+func _before_send_log(entry: SentryLog) -> SentryLog:
+	_bodies.append(entry.body)
+	_batch_frames.append(Engine.get_process_frames())
+	if _bodies.size() == 3:
+		batch_processed.emit.call_deferred()
+	return null
+
+
+## Logs should be held back and then sent together, in order and with their attributes.
+func test_logs_are_sent_in_batch() -> void:
+	var monitor := monitor_signals(self, false)
+	SentrySDK.logger.info("first")
+	SentrySDK.logger.info("second", [], {"level": "castle"})
+	assert_int(_bodies.size()).is_equal(0)
+	SentrySDK.logger.info("third")
+	await assert_signal(monitor).is_emitted("batch_processed")
+
+	assert_array(_bodies).contains_exactly(["first", "second", "third"])
+	assert_int(_batch_frames[0]).is_equal(_batch_frames[2])
+
+
+## Waiting logs should be sent before an event is captured.
+func test_logs_are_sent_before_event() -> void:
+	_bodies.clear()
+	SentrySDK.logger.info("before event")
+	assert_int(_bodies.size()).is_equal(0)
+	SentrySDK.capture_message("event after log")
+	assert_array(_bodies).contains_exactly(["before event"])
@@ -0,0 +1,41 @@
+extends GdUnitTestSuite
+## Structured logs over "log_rate_limits" should be dropped and reported in a summary.
+
+
+signal summary_processed
+
+var _bodies: PackedStringArray
+var _summary: SentryLog
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.log_rate_limits = { "info": 3 }
+		options.before_send_log = _before_send_log
+	)
+
+
+func _before_send_log(entry: SentryLog) -> SentryLog:
+	if entry.get_attribute("sentry.godot.rate_limited_count") != null:
+		_summary = entry
+		summary_processed.emit.call_deferred()
+	else:
+		_bodies.append(entry.body)
+	return null
+
+
+## Only logs within the limit should be sent, followed by a summary of the rest.
+func test_logs_over_limit_are_summarized() -> void:
+	var monitor := monitor_signals(self, false)
+	for i in 10:
+		SentrySDK.logger.info("Enemy not found")
+	assert_int(_bodies.size()).is_equal(3)
+
+	# Errors are not limited.
+	SentrySDK.logger.error("Level failed to load")
+	assert_int(_bodies.size()).is_equal(4)
+
+	await assert_signal(monitor).is_emitted("summary_processed")
+	assert_str(_summary.body).is_equal("Enemy not found (6 more similar)")
+	assert_int(_summary.get_attribute("sentry.godot.rate_limited_count")).is_equal(7)
+	assert_int(_summary.level).is_equal(SentryLog.LOG_LEVEL_INFO)
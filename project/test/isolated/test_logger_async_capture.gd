@@ -0,0 +1,45 @@
+extends GdUnitTestSuite
+## Errors should be captured on a worker thread when "godot_logger.async_capture" is enabled.
+
+
+signal callback_processed
+
+var _num_events: int = 0
+var _captured_on_main_thread: bool = true
+var _exception_value: String
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.godot_logger.async_capture = true
+		options.godot_logger.async_queue_size = 4
+
+		# Make sure other limits are not interfering.
+		options.godot_logger.limits.events_per_frame = 88
+		options.godot_logger.limits.throttle_events = 88
+		options.godot_logger.limits.repeated_error_window_ms = 0
+
+		options.before_send = _before_send
+	)
+
+
+func _before_send(ev: SentryEvent) -> SentryEvent:
+	if ev.is_crash():
+		# Likely processing previous crash.
+		return ev
+	_num_events += 1
+	_captured_on_main_thread = OS.get_thread_caller_id() == OS.get_main_thread_id()
+	_exception_value = ev.get_exception_value(0)
+	callback_processed.emit.call_deferred()
+	return null
+
+
+## Error should be turned into an event by the worker thread.
+func test_async_capture_uses_worker_thread() -> void:
+	var monitor := monitor_signals(self, false)
+	push_error("async-error")
+	await assert_signal(monitor).is_emitted("callback_processed")
+
+	assert_int(_num_events).is_equal(1)
+	assert_bool(_captured_on_main_thread).is_false()
+	assert_str(_exception_value).is_equal("async-error")
@@ -92,6 +92,29 @@ func test_distribution_with_unit() -> void:
 	SentrySDK.metrics.distribution("request_size", 256.0, "kilobyte")
 
 
+func test_start_timer() -> void:
+	metric_processed.connect(func(metric: SentryMetric):
+		assert_str(metric.name).is_equal("level_load_time")
+		assert_int(metric.type).is_equal(SentryMetric.METRIC_DISTRIBUTION)
+		assert_str(metric.unit).is_equal("millisecond")
+		assert_float(metric.value).is_greater_equal(1.0)
+		assert_str(metric.get_attribute("level")).is_equal("castle")
+	, CONNECT_ONE_SHOT)
+	var timer := SentrySDK.metrics.start_timer("level_load_time", {"level": "castle"})
+	assert_bool(timer.is_running()).is_true()
+	OS.delay_msec(2)
+	var elapsed := timer.stop()
+	assert_float(elapsed).is_greater_equal(1.0)
+	assert_bool(timer.is_running()).is_false()
+
+
+func test_start_timer_cancel() -> void:
+	var monitor := monitor_signals(self, false)
+	var timer := SentrySDK.metrics.start_timer("cancelled_timer")
+	timer.cancel()
+	assert_bool(timer.is_running()).is_false()
+	await assert_signal(monitor).is_not_emitted("metric_processed")
+
 func test_count_with_attributes() -> void:
 	metric_processed.connect(func(metric: SentryMetric):
 		assert_str(metric.get_attribute("level")).is_equal("forest")
@@ -107,6 +130,21 @@ func test_count_with_attributes() -> void:
 	})
 
 
+func test_count_with_precompiled_attributes() -> void:
+	var attributes := SentryAttributes.create({
+		"level": "forest",
+		"enemy_id": 42,
+		"health": 10.5,
+		"elite": false
+	})
+	metric_processed.connect(func(metric: SentryMetric):
+		assert_str(metric.get_attribute("level")).is_equal("forest")
+		assert_int(metric.get_attribute("enemy_id")).is_equal(42)
+		assert_float(metric.get_attribute("health")).is_equal_approx(10.5, 0.001)
+		assert_bool(metric.get_attribute("elite")).is_equal(false)
+	, CONNECT_ONE_SHOT)
+	SentrySDK.metrics.count("enemy_defeated", 1, attributes)
+
 func test_count_with_empty_attribute_key() -> void:
 	metric_processed.connect(func(metric: SentryMetric):
 		assert_that(metric.get_attribute("")).is_null()
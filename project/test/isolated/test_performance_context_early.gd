@@ -0,0 +1,35 @@
+extends SentryTestSuite
+## Events captured off the main thread before performance is first sampled should include cheap performance values.
+
+
+var _json: String
+
+
+func init_sdk() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.before_send = _before_send_early
+	)
+
+	# No frame has been processed since init, so performance hasn't been sampled yet.
+	var thread := Thread.new()
+	thread.start(func() -> void: SentrySDK.capture_event(SentrySDK.create_event()))
+	thread.wait_to_finish()
+
+
+func _before_send_early(event: SentryEvent) -> SentryEvent:
+	_json = event.to_json()
+	return null
+
+
+func test_performance_context_before_first_sample() -> void:
+	assert_str(_json).is_not_empty()
+
+	assert_json(_json).describe("Performance context has cheap values") \
+		.at("/contexts/godot_performance/frames_drawn") \
+		.is_number() \
+		.verify()
+
+	assert_json(_json).describe("Performance context has no unsampled values") \
+		.at("/contexts/godot_performance") \
+		.must_not_contain("rendering_video_mem_used") \
+		.verify()
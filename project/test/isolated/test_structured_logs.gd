@@ -117,6 +117,25 @@ func test_structured_logs_with_custom_attributes() -> void:
 	})
 
 
+func test_structured_logs_with_precompiled_attributes() -> void:
+	var attributes := SentryAttributes.create({
+		"level": "forest",
+		"enemy_id": 42,
+	})
+	log_processed.connect(func(entry: SentryLog):
+		assert_str(entry.get_attribute("level")).is_equal("forest")
+		assert_int(entry.get_attribute("enemy_id")).is_equal(42)
+	, CONNECT_ONE_SHOT)
+	SentrySDK.logger.info("Test 123", [], attributes)
+
+	# Parameters are merged with precompiled attributes.
+	log_processed.connect(func(entry: SentryLog):
+		assert_str(entry.body).is_equal("Test 123")
+		assert_str(entry.get_attribute("level")).is_equal("forest")
+		assert_int(entry.get_attribute("sentry.message.parameter.0")).is_equal(123)
+	, CONNECT_ONE_SHOT)
+	SentrySDK.logger.info("Test %d", [123], attributes)
+
 func test_structured_logs_with_empty_attribute_key() -> void:
 	log_processed.connect(func(entry: SentryLog):
 		assert_that(entry.get_attribute("")).is_null()
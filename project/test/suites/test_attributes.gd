@@ -0,0 +1,26 @@
+extends SentryTestSuite
+## Test SentryAttributes class.
+
+
+## SentryAttributes should keep attributes with names converted to strings.
+func test_attributes_create() -> void:
+	var attributes := SentryAttributes.create({
+		"level": "castle",
+		&"wave": 3,
+		"boss": true,
+		"difficulty": 1.5,
+	})
+	assert_bool(attributes.is_empty()).is_false()
+	assert_dict(attributes.get_dictionary()).is_equal({
+		"level": "castle",
+		"wave": 3,
+		"boss": true,
+		"difficulty": 1.5,
+	})
+
+
+func test_attributes_empty() -> void:
+	var attributes := SentryAttributes.create({})
+	assert_bool(attributes.is_empty()).is_true()
+	assert_dict(attributes.get_dictionary()).is_empty()
+
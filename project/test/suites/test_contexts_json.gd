@@ -53,6 +53,28 @@ func test_set_context_with_complex_data() -> void:
 		.verify()
 
 
+func test_set_context_with_packed_arrays_and_name_keys() -> void:
+	SentrySDK.set_context("packed_data", {
+		&"name_key": "value",
+		"ints": PackedInt32Array([1, 2, 3]),
+		"floats": PackedFloat64Array([0.5, 1.5]),
+		"strings": PackedStringArray(["a", "b"]),
+		"records": [{ &"id": 1 }, { &"id": 2 }],
+	})
+
+	var json: String = await capture_event_and_get_json(SentrySDK.create_event())
+
+	assert_json(json).describe("Verify StringName keys and packed arrays") \
+		.at("/contexts/packed_data") \
+		.is_object() \
+		.must_contain("name_key", "value") \
+		.must_contain("/ints/2", 3) \
+		.must_contain("/floats/1", 1.5) \
+		.must_contain("/strings/0", "a") \
+		.must_contain("/records/1/id", 2) \
+		.verify()
+
+
 func test_empty_context_is_captured() -> void:
 	SentrySDK.set_context("empty_context", {})
 
@@ -254,3 +276,17 @@ func test_os_context(_do_skip = OS.get_name() == "Web") -> void:
 		.must_contain("name") \
 		.must_contain("version") \
 		.verify()
+
+
+func test_godot_performance_context() -> void:
+	var json: String = await capture_event_and_get_json(SentrySDK.create_event())
+
+	assert_json(json).describe("Performance context has numeric values") \
+		.at("/contexts/godot_performance/frames_drawn") \
+		.is_number() \
+		.verify()
+
+	assert_json(json).describe("Performance context has numeric memory usage") \
+		.at("/contexts/godot_performance/rendering_video_mem_used") \
+		.is_number() \
+		.verify()
@@ -144,6 +144,28 @@ func test_gdscript_error_stacktrace_deep() -> void:
 			.verify()
 
 
+func test_gdscript_error_source_context_on_repeated_capture() -> void:
+	# First error loads the script source; second one is served from the source cache.
+	push_error("Source context first")
+	await wait_for_captured_event_json()
+
+	var expected_line: int = get_stack()[0].line + 1
+	push_error("Source context second")
+
+	var json: String = await wait_for_captured_event_json()
+
+	assert_json(json).describe("Frame contains exact source line and surrounding context") \
+		.at("/threads/values/0/stacktrace/frames") \
+		.is_array() \
+		.with_objects() \
+		.containing("platform", "gdscript") \
+		.containing("lineno", expected_line) \
+		.must_contain("context_line", "\tpush_error(\"Source context second\")") \
+		.must_contain("pre_context") \
+		.must_contain("post_context") \
+		.exactly(1)
+
+
 func test_local_variables_capture() -> void:
 	# Set up local variables for capture
 	@warning_ignore("unused_variable")
@@ -177,6 +199,26 @@ func test_local_variables_capture() -> void:
 		.exactly(1)
 
 
+
+func test_local_variables_fit_budget() -> void:
+	@warning_ignore("unused_variable")
+	var test_long_string: String = "x".repeat(5000)
+	@warning_ignore("unused_variable")
+	var test_nested: Array = [[[[["too deep"]]]]]
+
+	push_error("Variable budget test")
+
+	var json: String = await wait_for_captured_event_json()
+
+	assert_json(json).describe("Long strings and deeply nested values are trimmed") \
+		.at("/threads/values/0/stacktrace/frames/") \
+		.is_array() \
+		.with_objects() \
+		.containing("filename", get_script().resource_path) \
+		.must_contain("vars/test_long_string", "x".repeat(1024) + "...") \
+		.must_contain("vars/test_nested", [[[["[...]"]]]]) \
+		.exactly(1)
+
 func test_exception_value_with_utf8() -> void:
 	push_error("Error with UTF-8: 世界 🌍")
 
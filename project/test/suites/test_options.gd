@@ -17,7 +17,10 @@ func test_bool_properties(property: String, test_parameters := [
 		["attach_log"],
 		["attach_screenshot"],
 		["attach_scene_tree"],
+		["scene_tree_incremental"],
+		["performance_metrics"],
 		["send_default_pii"],
+		["context_bytes_as_base64"],
 ]) -> void:
 	options.set(property, true)
 	assert_bool(options.get(property)).is_true()
@@ -31,6 +34,7 @@ func test_godot_logger_bool_properties(property: String, test_parameters := [
 		["enabled"],
 		["include_source_context"],
 		["include_variables"],
+		["async_capture"],
 ]) -> void:
 	options.godot_logger.set(property, true)
 	assert_bool(options.godot_logger.get(property)).is_true()
@@ -56,18 +60,109 @@ func test_sample_rate() -> void:
 	assert_float(options.sample_rate).is_equal_approx(0.5, 0.01)
 
 
+## SentryOptions.context_max_array_elements should be set to the specified value.
+func test_context_max_array_elements() -> void:
+	assert_int(options.context_max_array_elements).is_equal(0)
+	options.context_max_array_elements = 256
+	assert_int(options.context_max_array_elements).is_equal(256)
+
+
 ## SentryOptions.max_breadcrumbs should be set to the specified value.
 func test_max_breadcrumbs() -> void:
 	options.max_breadcrumbs = 42
 	assert_int(options.max_breadcrumbs).is_equal(42)
 
 
+## SentryOptions.metrics_aggregation_interval_ms should be set to the specified value.
+func test_metrics_aggregation_interval_ms() -> void:
+	options.metrics_aggregation_interval_ms = 5000
+	assert_int(options.metrics_aggregation_interval_ms).is_equal(5000)
+
+
+## Test log batching properties.
+@warning_ignore("unused_parameter")
+func test_log_batching_properties(property: String, test_parameters := [
+		["log_batch_interval_ms"],
+		["log_batch_size"],
+]) -> void:
+	options.set(property, 42)
+	assert_int(options.get(property)).is_equal(42)
+
+
+## SentryOptions.log_rate_limits should be set to the specified limits.
+func test_log_rate_limits() -> void:
+	assert_dict(options.log_rate_limits).is_empty()
+	options.log_rate_limits = { "info": 50, "warn": 100 }
+	assert_dict(options.log_rate_limits).is_equal({ "info": 50, "warn": 100 })
+
 ## SentryOptions.shutdown_timeout_ms should be set to the specified value.
 func test_shutdown_timeout_ms() -> void:
 	options.shutdown_timeout_ms = 5000
 	assert_int(options.shutdown_timeout_ms).is_equal(5000)
 
 
+## Test screenshot encoding properties.
+func test_screenshot_properties() -> void:
+	options.screenshot_format = SentryOptions.SCREENSHOT_FORMAT_WEBP
+	assert_int(options.screenshot_format).is_equal(SentryOptions.SCREENSHOT_FORMAT_WEBP)
+	options.screenshot_quality = 0.5
+	assert_float(options.screenshot_quality).is_equal_approx(0.5, 0.01)
+	assert_int(options.screenshot_max_size).is_equal(0) # original size by default
+	options.screenshot_max_size = 640
+	assert_int(options.screenshot_max_size).is_equal(640)
+
+
+## Test frame history properties.
+@warning_ignore("unused_parameter")
+func test_screenshot_history_properties(property: String, test_parameters := [
+		["screenshot_history_frames"],
+		["screenshot_history_interval"],
+		["screenshot_history_frame_size"],
+]) -> void:
+	options.set(property, 42)
+	assert_int(options.get(property)).is_equal(42)
+
+
+## Frame history properties should be clamped to the supported range.
+func test_screenshot_history_clamping() -> void:
+	options.screenshot_history_frames = 1000
+	assert_int(options.screenshot_history_frames).is_equal(64)
+	options.screenshot_history_frames = -1
+	assert_int(options.screenshot_history_frames).is_equal(0)
+	options.screenshot_history_frame_size = 10000
+	assert_int(options.screenshot_history_frame_size).is_equal(1920)
+	options.screenshot_history_frame_size = 1
+	assert_int(options.screenshot_history_frame_size).is_equal(16)
+
+
+## Test frame hitch threshold properties.
+@warning_ignore("unused_parameter")
+func test_frame_hitch_properties(property: String, test_parameters := [
+		["frame_hitch_threshold_ms"],
+		["frame_severe_hitch_threshold_ms"],
+]) -> void:
+	options.set(property, 42)
+	assert_int(options.get(property)).is_equal(42)
+
+
+## Test scene tree capture limit properties.
+@warning_ignore("unused_parameter")
+func test_scene_tree_limit_properties(property: String, test_parameters := [
+		["scene_tree_max_nodes"],
+		["scene_tree_max_depth"],
+]) -> void:
+	assert_int(options.get(property)).is_equal(0) # unlimited by default
+	options.set(property, 42)
+	assert_int(options.get(property)).is_equal(42)
+
+
+## SentryOptions.scene_tree_collapse_rules should be set to the specified rules.
+func test_scene_tree_collapse_rules() -> void:
+	assert_dict(options.scene_tree_collapse_rules).is_empty()
+	options.scene_tree_collapse_rules = { "Bullet": 5 }
+	assert_dict(options.scene_tree_collapse_rules).is_equal({ "Bullet": 5 })
+
+
 ## Test mask properties on godot_logger options.
 @warning_ignore("unused_parameter")
 func test_godot_logger_mask_properties(property: String, test_parameters := [
@@ -80,11 +175,27 @@ func test_godot_logger_mask_properties(property: String, test_parameters := [
 	assert_int(options.godot_logger.get(property)).is_equal(mask)
 
 
+## Test asynchronous capture queue properties on godot_logger options.
+func test_godot_logger_async_queue_properties() -> void:
+	options.godot_logger.async_queue_size = 16
+	assert_int(options.godot_logger.async_queue_size).is_equal(16)
+	options.godot_logger.async_overflow_policy = SentryGodotLoggerOptions.OVERFLOW_DROP_OLDEST
+	assert_int(options.godot_logger.async_overflow_policy).is_equal(SentryGodotLoggerOptions.OVERFLOW_DROP_OLDEST)
+
+
+## SentryGodotLoggerOptions.message_filters should be set to the specified patterns.
+func test_godot_logger_message_filters() -> void:
+	assert_array(options.godot_logger.message_filters).is_empty()
+	options.godot_logger.message_filters = PackedStringArray(["[Network]*", "*deprecated*"])
+	assert_array(options.godot_logger.message_filters).contains_exactly(["[Network]*", "*deprecated*"])
+
+
 ## Test integer error logger limit properties.
 @warning_ignore("unused_parameter")
 func test_logger_limit_properties(property: String, test_parameters := [
 		["events_per_frame"],
 		["repeated_error_window_ms"],
+		["repeated_error_capacity"],
 		["throttle_events"],
 		["throttle_window_ms"],
 ]) -> void:
@@ -9,6 +9,7 @@
 #include "sentry/processing/view_hierarchy_processor.h"
 #include "sentry/runtime_config.h"
 #include "sentry/sentry_attachment.h"
+#include "sentry/sentry_attributes.h"
 #include "sentry/sentry_bad_code.h"
 #include "sentry/sentry_breadcrumb.h"
 #include "sentry/sentry_event.h"
@@ -16,6 +17,7 @@
 #include "sentry/sentry_log.h"
 #include "sentry/sentry_logger.h"
 #include "sentry/sentry_metric.h"
+#include "sentry/sentry_metric_timer.h"
 #include "sentry/sentry_metrics.h"
 #include "sentry/sentry_options.h"
 #include "sentry/sentry_scope.h"
@@ -83,9 +85,11 @@ void register_runtime_classes() {
 	GDREGISTER_CLASS(SentryOptions);
 	GDREGISTER_INTERNAL_CLASS(RuntimeConfig);
 	GDREGISTER_CLASS(SentryUser);
+	GDREGISTER_CLASS(SentryAttributes);
 	GDREGISTER_CLASS(SentryTimestamp);
 	GDREGISTER_CLASS(SentryLogger);
 	GDREGISTER_CLASS(SentryMetrics);
+	GDREGISTER_CLASS(SentryMetricTimer);
 	GDREGISTER_CLASS(SentryBadCode);
 	GDREGISTER_CLASS(SentryUnit);
 	GDREGISTER_CLASS(SentryFeedback);
@@ -142,7 +142,8 @@ void AndroidEvent::add_exception(const Exception &p_exception) {
 	ERR_FAIL_NULL(android_plugin);
 
 	Array stacktrace_frames;
-	for (const StackFrame &frame : p_exception.frames) {
+	for (int i = 0; i < p_exception.frames.size(); i++) {
+		const StackFrame &frame = p_exception.frames[i];
 		Dictionary frame_data;
 		frame_data["filename"] = frame.filename;
 		frame_data["function"] = frame.function;
@@ -155,9 +156,10 @@ void AndroidEvent::add_exception(const Exception &p_exception) {
 			frame_data["post_context"] = frame.post_context;
 		}
 
-		if (!frame.vars.is_empty()) {
+		Vector<Pair<String, Variant>> frame_vars = p_exception.get_frame_variables(i);
+		if (!frame_vars.is_empty()) {
 			Dictionary variables;
-			for (auto var : frame.vars) {
+			for (const Pair<String, Variant> &var : frame_vars) {
 				variables[var.first] = sanitize_variant(var.second);
 			}
 			frame_data["vars"] = variables;
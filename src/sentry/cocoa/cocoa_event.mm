@@ -230,7 +230,8 @@ void CocoaEvent::add_exception(const Exception &p_exception) {
 	ERR_FAIL_NULL(cocoa_event);
 
 	NSMutableArray *mut_frames = [NSMutableArray arrayWithCapacity:p_exception.frames.size()];
-	for (const StackFrame &frame : p_exception.frames) {
+	for (int i = 0; i < p_exception.frames.size(); i++) {
+		const StackFrame &frame = p_exception.frames[i];
 		SentryObjCFrame *cocoa_frame = [[SentryObjCFrame alloc] init];
 		cocoa_frame.fileName = string_to_objc(frame.filename);
 		cocoa_frame.function = string_to_objc(frame.function);
@@ -244,9 +245,10 @@ void CocoaEvent::add_exception(const Exception &p_exception) {
 			cocoa_frame.postContext = string_array_to_objc(frame.post_context);
 		}
 
-		if (!frame.vars.is_empty()) {
-			NSMutableDictionary *objc_vars = [NSMutableDictionary dictionaryWithCapacity:frame.vars.size()];
-			for (const auto &var : frame.vars) {
+		Vector<Pair<String, Variant>> frame_vars = p_exception.get_frame_variables(i);
+		if (!frame_vars.is_empty()) {
+			NSMutableDictionary *objc_vars = [NSMutableDictionary dictionaryWithCapacity:frame_vars.size()];
+			for (const auto &var : frame_vars) {
 				NSString *key = string_to_objc(var.first);
 				id value = variant_to_objc(var.second);
 				objc_vars[key] = value;
@@ -1,10 +1,18 @@
 #pragma once
 
 #define SENTRY_SCREENSHOT_FN "screenshot.jpg"
+#define SENTRY_SCREENSHOT_PNG_FN "screenshot.png"
+#define SENTRY_SCREENSHOT_WEBP_FN "screenshot.webp"
+#define SENTRY_FRAME_HISTORY_FN "frame-history.jpg"
 #define SENTRY_VIEW_HIERARCHY_FN "view-hierarchy.json"
 
 namespace sentry {
 
 constexpr int VARIANT_CONVERSION_MAX_DEPTH = 32;
 
+// Budgets for each script variable value attached to stack frames.
+constexpr int VARIABLE_MAX_DEPTH = 4;
+constexpr int VARIABLE_MAX_ITEMS = 128; // total number of collection elements in a value
+constexpr int VARIABLE_MAX_STRING_LENGTH = 1024;
+
 };
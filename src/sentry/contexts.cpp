@@ -9,10 +9,10 @@
 #include <godot_cpp/classes/display_server.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/os.hpp>
-#include <godot_cpp/classes/performance.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/time.hpp>
+#include <mutex>
 
 #ifdef SDK_NATIVE
 #include "sentry/native/platform_detection.h"
@@ -98,6 +98,41 @@ String _get_device_type() {
 	return "Unknown";
 }
 
+// Contexts created for events are refreshed periodically from the main thread and shared between events,
+// so that events don't repeat the same system queries (memory info, filesystem, screen orientation).
+constexpr uint64_t EVENT_CONTEXT_MAX_AGE_USEC = 1'000'000;
+
+struct CachedContext {
+	Dictionary value;
+	uint64_t sampled_usec = 0;
+	bool sampled = false;
+	bool dirty = true; // refresh on the next opportunity, regardless of age
+};
+
+std::mutex event_contexts_mutex;
+CachedContext cached_device_context;
+
+// Creates the context again if it was invalidated or is stale. Mutex must not be held.
+// Cached dictionaries are replaced rather than modified, so they can be safely read after unlocking.
+template <typename F>
+void _refresh_cached_context(CachedContext &p_cache, uint64_t p_now_usec, F p_make) {
+	{
+		std::lock_guard lock{ event_contexts_mutex };
+		if (!p_cache.dirty && p_now_usec - p_cache.sampled_usec < EVENT_CONTEXT_MAX_AGE_USEC) {
+			return;
+		}
+		// Cleared first, so concurrent refreshes don't repeat the queries.
+		p_cache.dirty = false;
+		p_cache.sampled_usec = p_now_usec;
+	}
+
+	Dictionary value = p_make();
+
+	std::lock_guard lock{ event_contexts_mutex };
+	p_cache.value = value;
+	p_cache.sampled = true;
+}
+
 template <typename... Fallbacks>
 inline void _set_context_value(Dictionary &p_context, const String &p_key, const String &p_value, Fallbacks... p_fallbacks) {
 	if (!p_value.is_empty()) {
@@ -485,59 +520,6 @@ Dictionary make_environment_context() {
 	return env_context;
 }
 
-Dictionary make_performance_context() {
-	Dictionary perf_context = Dictionary();
-	ERR_FAIL_NULL_V(OS::get_singleton(), perf_context);
-	ERR_FAIL_NULL_V(Engine::get_singleton(), perf_context);
-	ERR_FAIL_NULL_V(Performance::get_singleton(), perf_context);
-	ERR_FAIL_NULL_V(RenderingServer::get_singleton(), perf_context);
-
-	// * Injecting "Performance" context...
-
-	// Static memory allocation.
-	perf_context["static_memory_peak_usage"] = String::humanize_size(OS::get_singleton()->get_static_memory_peak_usage());
-	perf_context["static_memory_usage"] = String::humanize_size(OS::get_singleton()->get_static_memory_usage());
-
-#ifndef IOS_ENABLED
-	// NOTE: Memory info access on iOS can cause runtime errors in Godot 4.5.
-	Dictionary meminfo = OS::get_singleton()->get_memory_info();
-	perf_context["main_thread_stack_size"] = String::humanize_size(meminfo["stack"]);
-#endif // !IOS_ENABLED
-
-	double fps_metric = Engine::get_singleton()->get_frames_per_second();
-	if (fps_metric) {
-		perf_context["fps"] = fps_metric;
-	}
-
-	// Frames drawn since engine started - age metric.
-	perf_context["frames_drawn"] = Engine::get_singleton()->get_frames_drawn();
-
-	// Object allocation info.
-	perf_context["object_count"] = Performance::get_singleton()->get_monitor(Performance::OBJECT_COUNT);
-	perf_context["object_node_count"] = Performance::get_singleton()->get_monitor(Performance::OBJECT_NODE_COUNT);
-	perf_context["object_orphan_node_count"] = Performance::get_singleton()->get_monitor(Performance::OBJECT_ORPHAN_NODE_COUNT);
-	perf_context["object_resource_count"] = Performance::get_singleton()->get_monitor(Performance::OBJECT_RESOURCE_COUNT);
-
-	// VRAM usage.
-	uint64_t video_mem_used = RenderingServer::get_singleton()->get_rendering_info(RenderingServer::RENDERING_INFO_VIDEO_MEM_USED);
-	perf_context["rendering_video_mem_used"] = String::humanize_size(video_mem_used);
-	uint64_t texture_mem = RenderingServer::get_singleton()->get_rendering_info(RenderingServer::RENDERING_INFO_TEXTURE_MEM_USED);
-	perf_context["rendering_texture_mem_used"] = String::humanize_size(texture_mem);
-	uint64_t buffer_mem = RenderingServer::get_singleton()->get_rendering_info(RenderingServer::RENDERING_INFO_BUFFER_MEM_USED);
-	perf_context["rendering_buffer_mem_used"] = String::humanize_size(buffer_mem);
-
-	// Frame statistics.
-	uint64_t draw_calls = RenderingServer::get_singleton()->get_rendering_info(RenderingServer::RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME);
-	perf_context["rendering_draw_calls"] = draw_calls;
-
-	// TODO: Collect more useful metrics: physics, navigation, audio...
-	// TODO: Q: Split into categories and make it optional?
-	// TODO: Q: Make performance context optional?
-	// TODO: Q: Rename it?
-
-	return perf_context;
-}
-
 HashMap<String, Dictionary> make_event_contexts() {
 	HashMap<String, Dictionary> event_contexts;
 
@@ -547,15 +529,42 @@ HashMap<String, Dictionary> make_event_contexts() {
 		return event_contexts;
 	}
 
-	event_contexts["godot_performance"] = make_performance_context();
-
 #if defined(SDK_NATIVE) || defined(SDK_JAVASCRIPT)
 	// On native and JS, the Godot SDK owns "device" context.
-	// Fields that change at runtime are updated here.
-	event_contexts["device"] = make_device_context_update();
+	// Fields that change at runtime are updated from the cache.
+	bool sampled;
+	{
+		std::lock_guard lock{ event_contexts_mutex };
+		sampled = cached_device_context.sampled;
+	}
+	if (!sampled) {
+		// Not refreshed yet, e.g. events early in the app lifecycle.
+		refresh_event_contexts();
+	}
+
+	std::lock_guard lock{ event_contexts_mutex };
+	if (cached_device_context.sampled) {
+		event_contexts["device"] = cached_device_context.value;
+	}
 #endif
 
 	return event_contexts;
 }
 
+void refresh_event_contexts() {
+	if (!sentry::engine_lifecycle::are_engine_singletons_ready()) {
+		return;
+	}
+
+#if defined(SDK_NATIVE) || defined(SDK_JAVASCRIPT)
+	uint64_t now_usec = Time::get_singleton()->get_ticks_usec();
+	_refresh_cached_context(cached_device_context, now_usec, make_device_context_update);
+#endif
+}
+
+void invalidate_event_contexts() {
+	std::lock_guard lock{ event_contexts_mutex };
+	cached_device_context.dirty = true;
+}
+
 } //namespace sentry::contexts
@@ -27,9 +27,17 @@ Dictionary make_os_context_override();
 Dictionary make_runtime_context();
 Dictionary make_godot_engine_context();
 Dictionary make_environment_context();
-Dictionary make_performance_context();
 
-// Creates contexts that can only be generated right before an event, e.g. performance info.
+// Returns contexts with values that change at runtime, e.g. free memory.
+// Values come from the last refresh_event_contexts() and are shared between events, so no system
+// queries are made here, except for the first event if nothing was refreshed yet.
 HashMap<String, Dictionary> make_event_contexts();
 
+// Queries values for event contexts again if they were invalidated or are older than a second.
+// Called periodically on the main thread.
+void refresh_event_contexts();
+
+// Marks cached event contexts as outdated, so that the next refresh queries fresh values.
+void invalidate_event_contexts();
+
 } //namespace sentry::contexts
@@ -18,6 +18,7 @@ void process_default_attachments(sentry::Level p_level) {
 		if (processor->produces_default_attachment()) {
 			// Ignore the result: these processors write their attachments to disk, and the dummy event is never sent.
 			processor->process_event(dummy_event);
+			processor->finish_attachments();
 		}
 	}
 }
@@ -0,0 +1,82 @@
+#include "frame_timing_monitor.h"
+
+#include "sentry/sentry_sdk.h"
+
+#include <godot_cpp/classes/engine.hpp>
+
+namespace sentry {
+
+void FrameTimingMonitor::set_hitch_thresholds(int p_hitch_ms, int p_severe_hitch_ms) {
+	hitch_threshold_usec = uint64_t(MAX(0, p_hitch_ms)) * 1000;
+	severe_hitch_threshold_usec = uint64_t(MAX(0, p_severe_hitch_ms)) * 1000;
+}
+
+void FrameTimingMonitor::record_frame(uint64_t p_now_usec) {
+	uint64_t previous_usec = last_frame_usec;
+	last_frame_usec = p_now_usec;
+	if (previous_usec == 0 || p_now_usec <= previous_usec) {
+		return;
+	}
+
+	uint64_t frame_usec = p_now_usec - previous_usec;
+	if (frame_usec > util::FrameTimeHistogram::MAX_VALUE_USEC) {
+		// Most likely the app was suspended rather than stuck.
+		return;
+	}
+	histogram.record(frame_usec);
+
+	if (hitch_threshold_usec > 0 && frame_usec >= hitch_threshold_usec) {
+		hitch_count++;
+		interval_hitch_count++;
+	}
+	if (severe_hitch_threshold_usec > 0 && frame_usec >= severe_hitch_threshold_usec) {
+		severe_hitch_count++;
+		_add_hitch_breadcrumb(frame_usec);
+	}
+}
+
+void FrameTimingMonitor::_add_hitch_breadcrumb(uint64_t p_frame_usec) {
+	int64_t frame_ms = int64_t(p_frame_usec / 1000);
+
+	Dictionary data;
+	data["frame_time_ms"] = frame_ms;
+	data["threshold_ms"] = int64_t(severe_hitch_threshold_usec / 1000);
+	data["frame"] = Engine::get_singleton()->get_frames_drawn();
+
+	Ref<SentryBreadcrumb> crumb = SentryBreadcrumb::create(vformat("Frame hitch: %d ms", frame_ms));
+	crumb->set_level(sentry::LEVEL_WARNING);
+	crumb->set_category("performance");
+	crumb->set_data(data);
+	SentrySDK::get_singleton()->add_breadcrumb(crumb);
+}
+
+void FrameTimingMonitor::fill_snapshot(PerformanceSnapshot &r_snapshot) const {
+	if (histogram.get_count() >= MIN_PERCENTILE_FRAMES) {
+		r_snapshot.frame_time_p50_ms = histogram.get_value_at_percentile(50.0) * 0.001;
+		r_snapshot.frame_time_p95_ms = histogram.get_value_at_percentile(95.0) * 0.001;
+		r_snapshot.frame_time_p99_ms = histogram.get_value_at_percentile(99.0) * 0.001;
+	}
+	r_snapshot.frame_hitch_count = hitch_count;
+	r_snapshot.frame_severe_hitch_count = severe_hitch_count;
+}
+
+void FrameTimingMonitor::emit_metrics() const {
+	SentryMetrics *metrics = SentrySDK::get_singleton()->get_metrics();
+	ERR_FAIL_NULL(metrics);
+
+	if (histogram.get_count() >= MIN_PERCENTILE_FRAMES) {
+		metrics->distribution("godot.frame_time.p50", histogram.get_value_at_percentile(50.0) * 0.001, "millisecond");
+		metrics->distribution("godot.frame_time.p95", histogram.get_value_at_percentile(95.0) * 0.001, "millisecond");
+		metrics->distribution("godot.frame_time.p99", histogram.get_value_at_percentile(99.0) * 0.001, "millisecond");
+	}
+	if (interval_hitch_count > 0) {
+		metrics->count("godot.frame.hitches", interval_hitch_count);
+	}
+}
+
+void FrameTimingMonitor::start_interval() {
+	histogram.reset();
+	interval_hitch_count = 0;
+}
+
+} //namespace sentry
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "sentry/performance_snapshot.h"
+#include "sentry/util/frame_time_histogram.h"
+
+#include <cstdint>
+
+namespace sentry {
+
+// Records frame durations into a histogram and detects hitches, i.e. frames that take longer than a threshold.
+// Severe hitches are added as breadcrumbs. Percentiles are computed over a reporting interval,
+// which the owner starts periodically. Main thread only.
+class FrameTimingMonitor {
+private:
+	// Minimum number of frames for meaningful percentiles.
+	static constexpr uint32_t MIN_PERCENTILE_FRAMES = 10;
+
+	util::FrameTimeHistogram histogram;
+	uint64_t last_frame_usec = 0;
+
+	uint64_t hitch_threshold_usec = 0;
+	uint64_t severe_hitch_threshold_usec = 0;
+	int64_t hitch_count = 0;
+	int64_t severe_hitch_count = 0;
+	int64_t interval_hitch_count = 0;
+
+	void _add_hitch_breadcrumb(uint64_t p_frame_usec);
+
+public:
+	// Zero disables the respective detection.
+	void set_hitch_thresholds(int p_hitch_ms, int p_severe_hitch_ms);
+
+	// Called once per frame with the current time.
+	void record_frame(uint64_t p_now_usec);
+
+	// Fills frame time percentiles and hitch counts.
+	// Percentiles are left unchanged until the current interval has enough frames.
+	void fill_snapshot(PerformanceSnapshot &r_snapshot) const;
+
+	// Records percentiles of the current interval as distributions, and the number of hitches.
+	void emit_metrics() const;
+
+	void start_interval();
+};
+
+} //namespace sentry
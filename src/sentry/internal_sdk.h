@@ -3,6 +3,7 @@
 #include "sentry/level.h"
 #include "sentry/log_level.h"
 #include "sentry/sentry_attachment.h"
+#include "sentry/sentry_attributes.h"
 #include "sentry/sentry_breadcrumb.h"
 #include "sentry/sentry_event.h"
 #include "sentry/sentry_feedback.h"
@@ -32,6 +33,16 @@ public:
 	virtual void add_breadcrumb(const Ref<SentryBreadcrumb> &p_breadcrumb) = 0;
 
 	virtual void capture_log(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes = Dictionary()) = 0;
+	virtual void capture_log_compiled(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Ref<SentryAttributes> &p_attributes) {
+		capture_log(p_scope, p_level, p_body, p_attributes->get_attributes());
+	}
+	// Captures a log created earlier at p_timestamp (Unix time in seconds), such as a batched log. Uses p_compiled if valid.
+	// Backends that can't set the log timestamp keep the original time in an attribute instead.
+	virtual void capture_log_at(const Ref<SentryScope> &p_scope, double p_timestamp, LogLevel p_level, const String &p_body, const Dictionary &p_attributes, const Ref<SentryAttributes> &p_compiled) {
+		Dictionary attributes = p_compiled.is_valid() ? p_compiled->get_attributes().duplicate() : p_attributes.duplicate();
+		attributes["sentry.godot.log.timestamp"] = p_timestamp;
+		capture_log(p_scope, p_level, p_body, attributes);
+	}
 
 	virtual String get_last_event_id() = 0;
 
@@ -48,6 +59,17 @@ public:
 	virtual void metrics_add_gauge(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) = 0;
 	virtual void metrics_add_distribution(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) = 0;
 
+	// Variants with precompiled attributes. Backends that can't make use of the encoded entries fall back to the dictionary.
+	virtual void metrics_add_count_compiled(const Ref<SentryScope> &p_scope, const String &p_name, int64_t p_value, const Ref<SentryAttributes> &p_attributes) {
+		metrics_add_count(p_scope, p_name, p_value, p_attributes->get_attributes());
+	}
+	virtual void metrics_add_gauge_compiled(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Ref<SentryAttributes> &p_attributes) {
+		metrics_add_gauge(p_scope, p_name, p_value, p_unit, p_attributes->get_attributes());
+	}
+	virtual void metrics_add_distribution_compiled(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Ref<SentryAttributes> &p_attributes) {
+		metrics_add_distribution(p_scope, p_name, p_value, p_unit, p_attributes->get_attributes());
+	}
+
 	virtual void set_attribute(const String &p_name, const Variant &p_value) = 0;
 	virtual void remove_attribute(const String &p_name) = 0;
 
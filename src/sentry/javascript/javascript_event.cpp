@@ -1,5 +1,6 @@
 #include "javascript_event.h"
 
+#include "sentry/javascript/javascript_util.h"
 #include "sentry/util/json_writer.h"
 #include "sentry/uuid.h"
 
@@ -13,12 +14,13 @@ namespace {
 
 // Helper function to write stacktrace object with frames to a JSONWriter.
 // Writes: "stacktrace": { "frames": [...] }
-void write_stacktrace_json(sentry::util::JSONWriter &p_jw, const Vector<SentryEvent::StackFrame> &p_frames) {
+void write_stacktrace_json(sentry::util::JSONWriter &p_jw, const SentryEvent::Exception &p_exception) {
 	p_jw.key("stacktrace");
 	p_jw.begin_object(); // stacktrace {
 	p_jw.key("frames");
 	p_jw.begin_array(); // frames [
-	for (const SentryEvent::StackFrame &frame : p_frames) {
+	for (int i = 0; i < p_exception.frames.size(); i++) {
+		const SentryEvent::StackFrame &frame = p_exception.frames[i];
 		p_jw.begin_object(); // frame {
 		p_jw.kv_string("filename", frame.filename);
 		p_jw.kv_string("function", frame.function);
@@ -36,11 +38,12 @@ void write_stacktrace_json(sentry::util::JSONWriter &p_jw, const Vector<SentryEv
 		if (!frame.post_context.is_empty()) {
 			p_jw.kv_string_array("post_context", frame.post_context);
 		}
-		if (!frame.vars.is_empty()) {
+		Vector<Pair<String, Variant>> frame_vars = p_exception.get_frame_variables(i);
+		if (!frame_vars.is_empty()) {
 			p_jw.key("vars");
 			p_jw.begin_object(); // vars {
-			for (int j = 0; j < frame.vars.size(); j++) {
-				p_jw.kv_variant(frame.vars[j].first, frame.vars[j].second);
+			for (int j = 0; j < frame_vars.size(); j++) {
+				p_jw.kv_variant(frame_vars[j].first, frame_vars[j].second);
 			}
 			p_jw.end_object(); // } vars
 		}
@@ -216,7 +219,7 @@ void JavaScriptEvent::set_context(const String &p_key, const Dictionary &p_value
 	ERR_FAIL_COND(!js_obj);
 	JSObjectPtr all_contexts_jso = js_obj->get_or_create_object_property("contexts");
 	if (all_contexts_jso) {
-		all_contexts_jso->set_property_from_json(p_key.utf8(), JSON::stringify(p_value).utf8());
+		all_contexts_jso->set_property_from_json(p_key.utf8(), context_to_json(p_value));
 	}
 }
 
@@ -226,7 +229,7 @@ void JavaScriptEvent::merge_context(const String &p_key, const Dictionary &p_val
 	if (all_contexts_jso) {
 		JSObjectPtr context_jso = all_contexts_jso->get_or_create_object_property(p_key.utf8());
 		if (context_jso) {
-			context_jso->merge_properties_from_json(JSON::stringify(p_value).utf8());
+			context_jso->merge_properties_from_json(context_to_json(p_value));
 		}
 	}
 }
@@ -245,14 +248,14 @@ void JavaScriptEvent::add_exception(const Exception &p_exception) {
 		jw.kv_bool("main", is_main);
 		jw.kv_bool("crashed", true);
 		jw.kv_bool("current", true);
-		write_stacktrace_json(jw, p_exception.frames);
+		write_stacktrace_json(jw, p_exception);
 		jw.end_object(); // } thread
 
 		JSObjectPtr threads_obj = js_obj->get_or_create_object_property("threads");
 		if (threads_obj) {
 			JSObjectPtr threads_arr = threads_obj->get_or_create_array_property("values");
 			if (threads_arr) {
-				threads_arr->push_element_from_json(jw.get_string().utf8());
+				threads_arr->push_element_from_json(jw.get_utf8());
 			}
 		}
 	}
@@ -270,7 +273,7 @@ void JavaScriptEvent::add_exception(const Exception &p_exception) {
 	if (exception_obj) {
 		JSObjectPtr values_arr = exception_obj->get_or_create_array_property("values");
 		if (values_arr) {
-			values_arr->push_element_from_json(exc_jw.get_string().utf8());
+			values_arr->push_element_from_json(exc_jw.get_utf8());
 		}
 	}
 }
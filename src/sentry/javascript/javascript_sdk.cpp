@@ -129,7 +129,7 @@ inline JSObjectPtr _get_scope_object(const Ref<SentryScope> &p_scope) {
 
 void JavaScriptSDK::set_context(const String &p_key, const Dictionary &p_value) {
 	ERR_FAIL_COND(!js_bridge());
-	js_bridge()->call("setContext", p_key.utf8(), JSON::stringify(p_value).utf8());
+	js_bridge()->call("setContext", p_key.utf8(), context_to_json(p_value));
 }
 
 void JavaScriptSDK::remove_context(const String &p_key) {
@@ -182,27 +182,27 @@ void JavaScriptSDK::add_breadcrumb(const Ref<SentryBreadcrumb> &p_breadcrumb) {
 void JavaScriptSDK::capture_log(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes) {
 	ERR_FAIL_COND(!js_bridge());
 
-	String attr_value = attributes_to_json(p_attributes);
+	CharString attr_value = attributes_to_json(p_attributes);
 	JSObjectPtr scope_obj = _get_scope_object(p_scope);
 
 	switch (p_level) {
 		case LOG_LEVEL_TRACE: {
-			js_bridge()->call("logTrace", p_body.utf8(), attr_value.utf8(), scope_obj);
+			js_bridge()->call("logTrace", p_body.utf8(), attr_value, scope_obj);
 		} break;
 		case LOG_LEVEL_DEBUG: {
-			js_bridge()->call("logDebug", p_body.utf8(), attr_value.utf8(), scope_obj);
+			js_bridge()->call("logDebug", p_body.utf8(), attr_value, scope_obj);
 		} break;
 		case LOG_LEVEL_INFO: {
-			js_bridge()->call("logInfo", p_body.utf8(), attr_value.utf8(), scope_obj);
+			js_bridge()->call("logInfo", p_body.utf8(), attr_value, scope_obj);
 		} break;
 		case LOG_LEVEL_WARN: {
-			js_bridge()->call("logWarn", p_body.utf8(), attr_value.utf8(), scope_obj);
+			js_bridge()->call("logWarn", p_body.utf8(), attr_value, scope_obj);
 		} break;
 		case LOG_LEVEL_ERROR: {
-			js_bridge()->call("logError", p_body.utf8(), attr_value.utf8(), scope_obj);
+			js_bridge()->call("logError", p_body.utf8(), attr_value, scope_obj);
 		} break;
 		case LOG_LEVEL_FATAL: {
-			js_bridge()->call("logFatal", p_body.utf8(), attr_value.utf8(), scope_obj);
+			js_bridge()->call("logFatal", p_body.utf8(), attr_value, scope_obj);
 		} break;
 	}
 }
@@ -275,20 +275,20 @@ void JavaScriptSDK::_add_default_attachments() {
 
 void JavaScriptSDK::metrics_add_count(const Ref<SentryScope> &p_scope, const String &p_name, int64_t p_value, const Dictionary &p_attributes) {
 	ERR_FAIL_COND(!js_bridge());
-	String attr_value = attributes_to_json(p_attributes);
-	js_bridge()->call("metricsAddCount", p_name.utf8(), p_value, attr_value.utf8(), _get_scope_object(p_scope));
+	CharString attr_value = attributes_to_json(p_attributes);
+	js_bridge()->call("metricsAddCount", p_name.utf8(), p_value, attr_value, _get_scope_object(p_scope));
 }
 
 void JavaScriptSDK::metrics_add_gauge(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) {
 	ERR_FAIL_COND(!js_bridge());
-	String attr_value = attributes_to_json(p_attributes);
-	js_bridge()->call("metricsAddGauge", p_name.utf8(), p_value, p_unit.utf8(), attr_value.utf8(), _get_scope_object(p_scope));
+	CharString attr_value = attributes_to_json(p_attributes);
+	js_bridge()->call("metricsAddGauge", p_name.utf8(), p_value, p_unit.utf8(), attr_value, _get_scope_object(p_scope));
 }
 
 void JavaScriptSDK::metrics_add_distribution(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) {
 	ERR_FAIL_COND(!js_bridge());
-	String attr_value = attributes_to_json(p_attributes);
-	js_bridge()->call("metricsAddDistribution", p_name.utf8(), p_value, p_unit.utf8(), attr_value.utf8(), _get_scope_object(p_scope));
+	CharString attr_value = attributes_to_json(p_attributes);
+	js_bridge()->call("metricsAddDistribution", p_name.utf8(), p_value, p_unit.utf8(), attr_value, _get_scope_object(p_scope));
 }
 
 void JavaScriptSDK::set_attribute(const String &p_name, const Variant &p_value) {
@@ -1,12 +1,13 @@
 #include "javascript_util.h"
 
+#include "sentry/sentry_sdk.h"
 #include "sentry/util/json_writer.h"
 
 namespace sentry::javascript {
 
-String attributes_to_json(const Dictionary &p_attributes) {
+CharString attributes_to_json(const Dictionary &p_attributes) {
 	if (p_attributes.is_empty()) {
-		return String();
+		return CharString();
 	}
 
 	util::JSONWriter writer;
@@ -42,7 +43,15 @@ String attributes_to_json(const Dictionary &p_attributes) {
 	}
 
 	writer.end_object();
-	return writer.get_string();
+	return writer.get_char_string();
+}
+
+CharString context_to_json(const Dictionary &p_context) {
+	util::JSONWriter writer;
+	writer.set_max_array_elements(SENTRY_OPTIONS()->get_context_max_array_elements());
+	writer.set_bytes_as_base64(SENTRY_OPTIONS()->is_context_bytes_as_base64_enabled());
+	writer.value_dictionary(p_context);
+	return writer.get_char_string();
 }
 
 Variant sentry_js_object_get_attribute(const JSObjectPtr &p_object, const String &p_name) {
@@ -9,9 +9,13 @@ using namespace godot;
 
 namespace sentry::javascript {
 
-// Convert a Dictionary of attributes to a JSON string.
+// Convert a Dictionary of attributes to a UTF-8 JSON string.
 // Supported types (bool, int, float, string) are preserved, others are stringified.
-String attributes_to_json(const Dictionary &p_attributes);
+CharString attributes_to_json(const Dictionary &p_attributes);
+
+// Convert a context Dictionary to a UTF-8 JSON string, applying the array options from SentryOptions
+// (context_max_array_elements and context_bytes_as_base64).
+CharString context_to_json(const Dictionary &p_context);
 
 Variant sentry_js_object_get_attribute(const JSObjectPtr &p_object, const String &p_name);
 void sentry_js_object_set_attribute(const JSObjectPtr &p_object, const String &p_name, const Variant &p_value);
@@ -0,0 +1,110 @@
+#include "log_batcher.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace sentry::logging {
+
+int LogBatcher::_get_thread_buffer_index() {
+	static thread_local int index = int(std::hash<std::thread::id>{}(std::this_thread::get_id()) % BUFFER_COUNT);
+	return index;
+}
+
+bool LogBatcher::append(Record &&p_record) {
+	int size = get_batch_size();
+	size_t capacity = size_t(size) * CAPACITY_FACTOR;
+
+	Buffer &buffer = buffers[_get_thread_buffer_index()];
+	std::lock_guard lock{ buffer.mutex };
+
+	if (buffer.records.size() != capacity) {
+		if (buffer.count == 0) {
+			buffer.records.resize(capacity);
+			buffer.head = 0;
+		} else {
+			// Batch size changed while logs are waiting: keep the current buffer until it's flushed.
+			capacity = buffer.records.size();
+		}
+	}
+
+	if (buffer.count == capacity) {
+		// Drop the oldest log.
+		buffer.records[buffer.head] = Record();
+		buffer.head = (buffer.head + 1) % capacity;
+		buffer.count--;
+		dropped_count.fetch_add(1, std::memory_order_relaxed);
+		unreported_dropped_count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	buffer.records[(buffer.head + buffer.count) % capacity] = std::move(p_record);
+	buffer.count++;
+
+	if (buffer.count >= size_t(size)) {
+		batch_ready.store(true, std::memory_order_relaxed);
+		return true;
+	}
+	return false;
+}
+
+bool LogBatcher::try_start_flush(uint64_t p_now_msec, uint64_t p_interval_msec) {
+	uint64_t last = last_flush_msec.load(std::memory_order_relaxed);
+	if (last == 0) {
+		last_flush_msec.compare_exchange_strong(last, p_now_msec, std::memory_order_relaxed);
+		return batch_ready.exchange(false, std::memory_order_relaxed);
+	}
+	if (batch_ready.exchange(false, std::memory_order_relaxed)) {
+		last_flush_msec.store(p_now_msec, std::memory_order_relaxed);
+		return true;
+	}
+	if (p_now_msec - last < p_interval_msec) {
+		return false;
+	}
+	return last_flush_msec.compare_exchange_strong(last, p_now_msec, std::memory_order_relaxed);
+}
+
+void LogBatcher::flush(const CaptureFunc &p_capture, bool p_skip_locked) {
+	std::vector<Record> pending;
+	for (Buffer &buffer : buffers) {
+		std::unique_lock lock{ buffer.mutex, std::defer_lock };
+		if (p_skip_locked) {
+			if (!lock.try_lock()) {
+				continue;
+			}
+		} else {
+			lock.lock();
+		}
+		if (buffer.count == 0) {
+			continue;
+		}
+		size_t capacity = buffer.records.size();
+		pending.reserve(pending.size() + buffer.count);
+		for (size_t i = 0; i < buffer.count; i++) {
+			Record &record = buffer.records[(buffer.head + i) % capacity];
+			pending.push_back(std::move(record));
+			record = Record();
+		}
+		buffer.head = 0;
+		buffer.count = 0;
+	}
+
+	// Buffers are shared by threads, so merge them back into the order logs were created in.
+	std::stable_sort(pending.begin(), pending.end(), [](const Record &a, const Record &b) {
+		return a.timestamp < b.timestamp;
+	});
+
+	for (const Record &record : pending) {
+		p_capture(record);
+	}
+}
+
+bool LogBatcher::is_empty() {
+	for (Buffer &buffer : buffers) {
+		std::lock_guard lock{ buffer.mutex };
+		if (buffer.count > 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} //namespace sentry::logging
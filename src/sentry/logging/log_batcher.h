@@ -0,0 +1,82 @@
+#pragma once
+
+#include "sentry/log_level.h"
+#include "sentry/sentry_attributes.h"
+#include "sentry/sentry_scope.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+using namespace godot;
+
+namespace sentry::logging {
+
+// Collects structured logs in fixed-size ring buffers so that they can be sent to the backend in batches.
+// Each thread appends to its own buffer (threads are spread over a fixed number of buffers), so threads
+// rarely contend for a lock. When a buffer is full, the oldest log is dropped and counted.
+// Thread-safe.
+class LogBatcher {
+public:
+	static constexpr int BUFFER_COUNT = 4;
+	// Ring buffer capacity in multiples of the batch size.
+	static constexpr int CAPACITY_FACTOR = 4;
+
+	struct Record {
+		// Snapshot of the logging thread's scope, taken when the log is appended.
+		Ref<SentryScope> scope;
+		// Unix time in seconds when the log was created.
+		double timestamp = 0.0;
+		LogLevel level = LOG_LEVEL_INFO;
+		String body;
+		// Either a dictionary that the caller no longer modifies, or precompiled attributes.
+		Dictionary attributes;
+		Ref<SentryAttributes> compiled;
+	};
+
+	using CaptureFunc = std::function<void(const Record &)>;
+
+private:
+	struct Buffer {
+		std::mutex mutex;
+		std::vector<Record> records;
+		size_t head = 0;
+		size_t count = 0;
+	};
+
+	std::array<Buffer, BUFFER_COUNT> buffers;
+	std::atomic<int> batch_size{ 100 };
+	std::atomic<uint64_t> dropped_count{ 0 };
+	std::atomic<uint64_t> unreported_dropped_count{ 0 };
+	std::atomic<uint64_t> last_flush_msec{ 0 };
+	std::atomic<bool> batch_ready{ false };
+
+	static int _get_thread_buffer_index();
+
+public:
+	void set_batch_size(int p_size) { batch_size.store(MAX(1, p_size), std::memory_order_relaxed); }
+	int get_batch_size() const { return batch_size.load(std::memory_order_relaxed); }
+
+	// Returns true if a full batch is waiting and should be flushed soon.
+	bool append(Record &&p_record);
+
+	// Checks if a batch is ready or the interval since the last flush has elapsed, and restarts the interval if so.
+	bool try_start_flush(uint64_t p_now_msec, uint64_t p_interval_msec);
+
+	// Passes waiting logs to p_capture in timestamp order, and clears them. Called outside of buffer locks.
+	// If p_skip_locked is true, buffers locked by another thread are left as they are, such as when crashing.
+	void flush(const CaptureFunc &p_capture, bool p_skip_locked = false);
+
+	bool is_empty();
+
+	// Total number of logs dropped because a buffer was full.
+	uint64_t get_dropped_count() const { return dropped_count.load(std::memory_order_relaxed); }
+
+	// Returns the number of logs dropped since the last call.
+	uint64_t take_unreported_dropped_count() { return unreported_dropped_count.exchange(0, std::memory_order_relaxed); }
+};
+
+} //namespace sentry::logging
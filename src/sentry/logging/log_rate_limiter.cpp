@@ -0,0 +1,126 @@
+#include "log_rate_limiter.h"
+
+namespace sentry::logging {
+
+void LogRateLimiter::configure(const Dictionary &p_limits) {
+	std::lock_guard lock{ mutex };
+
+	bool any_limited = false;
+	for (int i = 0; i < LEVEL_COUNT; i++) {
+		LogLevel level = LogLevel(i);
+		double rate = double(p_limits.get(log_level_as_string(level), 0));
+		rates[i] = MAX(rate, 0.0);
+		any_limited = any_limited || rates[i] > 0.0;
+	}
+
+	for (const Variant &key : p_limits.keys()) {
+		bool known = false;
+		for (int i = 0; i < LEVEL_COUNT; i++) {
+			known = known || key == Variant(log_level_as_string(LogLevel(i)));
+		}
+		if (!known) {
+			ERR_PRINT(vformat("Sentry: Unknown log level in log rate limits: \"%s\".", key));
+		}
+	}
+
+	buckets.clear();
+	has_suppressed.store(false, std::memory_order_relaxed);
+	enabled.store(any_limited, std::memory_order_relaxed);
+}
+
+void LogRateLimiter::_refill(Bucket &p_bucket, uint64_t p_now_usec) {
+	double rate = rates[p_bucket.level];
+	if (p_now_usec > p_bucket.last_refill_usec) {
+		double elapsed_sec = (p_now_usec - p_bucket.last_refill_usec) * 0.000'001;
+		// A pending summary needs a token of its own, so slow rates must be able to hold two.
+		double capacity = MAX(rate, p_bucket.suppressed_count > 0 ? 2.0 : 1.0);
+		p_bucket.tokens = MIN(capacity, p_bucket.tokens + elapsed_sec * rate);
+	}
+	p_bucket.last_refill_usec = p_now_usec;
+}
+
+LogRateLimiter::Bucket &LogRateLimiter::_get_bucket(LogLevel p_level, const String &p_origin, uint64_t p_now_usec) {
+	uint64_t key = (uint64_t(p_origin.hash()) << 8) | uint64_t(p_level);
+	auto it = buckets.find(key);
+	if (it == buckets.end() && buckets.size() >= MAX_BUCKETS) {
+		key = uint64_t(p_level);
+		it = buckets.find(key);
+	}
+	if (it != buckets.end()) {
+		return it->second;
+	}
+
+	Bucket &bucket = buckets[key];
+	bucket.level = p_level;
+	bucket.origin = key == uint64_t(p_level) ? String() : p_origin;
+	bucket.tokens = MAX(rates[p_level], 1.0);
+	bucket.last_refill_usec = p_now_usec;
+	return bucket;
+}
+
+bool LogRateLimiter::try_acquire(LogLevel p_level, const String &p_origin, const String &p_body, uint64_t p_now_usec) {
+	ERR_FAIL_INDEX_V(p_level, LEVEL_COUNT, true);
+	if (!is_enabled()) {
+		return true;
+	}
+
+	std::lock_guard lock{ mutex };
+	if (rates[p_level] <= 0.0) {
+		return true;
+	}
+
+	Bucket &bucket = _get_bucket(p_level, p_origin, p_now_usec);
+	_refill(bucket, p_now_usec);
+
+	// Summary of suppressed logs goes first, so the bucket needs room for it too.
+	double needed = bucket.suppressed_count > 0 ? 2.0 : 1.0;
+	if (bucket.tokens >= needed) {
+		bucket.tokens -= 1.0;
+		return true;
+	}
+
+	if (bucket.suppressed_count == 0) {
+		bucket.suppressed_body = p_body;
+		bucket.suppressed_same_body = true;
+	} else if (bucket.suppressed_same_body && bucket.suppressed_body != p_body) {
+		bucket.suppressed_same_body = false;
+	}
+	bucket.suppressed_count++;
+	has_suppressed.store(true, std::memory_order_relaxed);
+	return false;
+}
+
+void LogRateLimiter::take_summaries(uint64_t p_now_usec, bool p_force, std::vector<Summary> &r_summaries) {
+	if (!has_suppressed_logs()) {
+		return;
+	}
+
+	std::lock_guard lock{ mutex };
+	bool remaining = false;
+	for (auto &kv : buckets) {
+		Bucket &bucket = kv.second;
+		if (bucket.suppressed_count == 0) {
+			continue;
+		}
+		_refill(bucket, p_now_usec);
+		if (!p_force && bucket.tokens < 1.0) {
+			remaining = true;
+			continue;
+		}
+		bucket.tokens = MAX(0.0, bucket.tokens - 1.0);
+
+		Summary summary;
+		summary.level = bucket.level;
+		summary.origin = bucket.origin;
+		summary.body = bucket.suppressed_body;
+		summary.count = bucket.suppressed_count;
+		summary.same_body = bucket.suppressed_same_body;
+		r_summaries.push_back(summary);
+
+		bucket.suppressed_count = 0;
+		bucket.suppressed_body = String();
+	}
+	has_suppressed.store(remaining, std::memory_order_relaxed);
+}
+
+} //namespace sentry::logging
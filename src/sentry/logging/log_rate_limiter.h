@@ -0,0 +1,72 @@
+#pragma once
+
+#include "sentry/log_level.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+namespace sentry::logging {
+
+// Token-bucket rate limiter for structured logs, with a separate bucket for each log level and origin.
+// Each bucket allows a burst of up to one second worth of logs and refills at the configured rate.
+// Logs over the limit are counted, and reported as a single summary once the bucket has room again.
+// Thread-safe.
+class LogRateLimiter {
+public:
+	static constexpr int LEVEL_COUNT = LOG_LEVEL_FATAL + 1;
+	// Logs from further origins share one bucket per level.
+	static constexpr int MAX_BUCKETS = 64;
+
+	struct Summary {
+		LogLevel level = LOG_LEVEL_INFO;
+		String origin;
+		String body; // body of the first suppressed log
+		int64_t count = 0;
+		bool same_body = true; // all suppressed logs had the same body
+	};
+
+private:
+	struct Bucket {
+		LogLevel level = LOG_LEVEL_INFO;
+		String origin;
+		double tokens = 0.0;
+		uint64_t last_refill_usec = 0;
+
+		int64_t suppressed_count = 0;
+		String suppressed_body;
+		bool suppressed_same_body = true;
+	};
+
+	std::mutex mutex;
+	std::array<double, LEVEL_COUNT> rates{}; // logs per second; 0 means unlimited
+	std::unordered_map<uint64_t, Bucket> buckets;
+	std::atomic<bool> enabled{ false };
+	std::atomic<bool> has_suppressed{ false };
+
+	Bucket &_get_bucket(LogLevel p_level, const String &p_origin, uint64_t p_now_usec);
+	void _refill(Bucket &p_bucket, uint64_t p_now_usec);
+
+public:
+	// Takes logs per second keyed by level name ("trace", "debug", "info", "warn", "error" and "fatal").
+	// Levels that are missing or set to 0 are not limited.
+	void configure(const Dictionary &p_limits);
+
+	_FORCE_INLINE_ bool is_enabled() const { return enabled.load(std::memory_order_relaxed); }
+	_FORCE_INLINE_ bool has_suppressed_logs() const { return has_suppressed.load(std::memory_order_relaxed); }
+
+	// Returns true if the log can be sent, or counts it as suppressed.
+	bool try_acquire(LogLevel p_level, const String &p_origin, const String &p_body, uint64_t p_now_usec);
+
+	// Collects summaries for buckets that have room again, or for all buckets if p_force is true.
+	void take_summaries(uint64_t p_now_usec, bool p_force, std::vector<Summary> &r_summaries);
+};
+
+} //namespace sentry::logging
@@ -0,0 +1,185 @@
+#include "message_filter.h"
+
+#include <algorithm>
+#include <queue>
+
+namespace sentry::logging {
+
+int32_t MessageFilter::_find_edge(int32_t p_node, char32_t p_char) const {
+	const auto &edges = nodes[p_node].edges;
+	auto it = std::lower_bound(edges.begin(), edges.end(), p_char,
+			[](const std::pair<char32_t, int32_t> &p_edge, char32_t p_c) { return p_edge.first < p_c; });
+	return (it != edges.end() && it->first == p_char) ? it->second : -1;
+}
+
+int32_t MessageFilter::_step(int32_t p_node, char32_t p_char) const {
+	while (true) {
+		int32_t next = _find_edge(p_node, p_char);
+		if (next != -1) {
+			return next;
+		}
+		if (p_node == 0) {
+			return 0;
+		}
+		p_node = nodes[p_node].fail;
+	}
+}
+
+void MessageFilter::_add_key(const String &p_literal, RuleKind p_kind, int32_t p_glob_index) {
+	int32_t node = 0;
+	for (int64_t i = 0; i < p_literal.length(); i++) {
+		char32_t c = p_literal[i];
+		int32_t next = _find_edge(node, c);
+		if (next == -1) {
+			next = (int32_t)nodes.size();
+			nodes.emplace_back();
+			auto &edges = nodes[node].edges;
+			auto it = std::lower_bound(edges.begin(), edges.end(), c,
+					[](const std::pair<char32_t, int32_t> &p_edge, char32_t p_c) { return p_edge.first < p_c; });
+			edges.insert(it, { c, next });
+		}
+		node = next;
+	}
+	nodes[node].keys.push_back((int32_t)keys.size());
+	keys.push_back({ (int32_t)p_literal.length(), p_kind, p_glob_index });
+}
+
+void MessageFilter::_add_pattern(const String &p_pattern) {
+	if (p_pattern.is_empty()) {
+		return;
+	}
+
+	bool has_question = p_pattern.contains("?");
+	int64_t num_stars = p_pattern.count("*");
+	int64_t len = p_pattern.length();
+
+	if (!has_question) {
+		if (num_stars == 0) {
+			_add_key(p_pattern, RULE_EXACT);
+			return;
+		}
+		if (num_stars == len) {
+			match_all = true;
+			return;
+		}
+		bool leading = p_pattern[0] == '*';
+		bool trailing = p_pattern[len - 1] == '*';
+		if (num_stars == 1 && trailing) {
+			_add_key(p_pattern.substr(0, len - 1), RULE_PREFIX);
+			return;
+		}
+		if (num_stars == 1 && leading) {
+			_add_key(p_pattern.substr(1), RULE_SUFFIX);
+			return;
+		}
+		if (num_stars == 2 && leading && trailing) {
+			_add_key(p_pattern.substr(1, len - 2), RULE_SUBSTRING);
+			return;
+		}
+	}
+
+	// General glob: index by its longest literal part, verify with String::match().
+	String longest;
+	int64_t run_start = 0;
+	for (int64_t i = 0; i <= len; i++) {
+		if (i == len || p_pattern[i] == '*' || p_pattern[i] == '?') {
+			if (i - run_start > longest.length()) {
+				longest = p_pattern.substr(run_start, i - run_start);
+			}
+			run_start = i + 1;
+		}
+	}
+
+	if (longest.is_empty()) {
+		unindexed_globs.push_back(p_pattern);
+	} else {
+		_add_key(longest, RULE_GLOB, (int32_t)globs.size());
+		globs.push_back(p_pattern);
+	}
+}
+
+void MessageFilter::_build_links() {
+	std::queue<int32_t> queue;
+	for (const auto &edge : nodes[0].edges) {
+		nodes[edge.second].fail = 0;
+		queue.push(edge.second);
+	}
+
+	while (!queue.empty()) {
+		int32_t node = queue.front();
+		queue.pop();
+
+		int32_t fail = nodes[node].fail;
+		nodes[node].dict_link = !nodes[fail].keys.empty() ? fail : nodes[fail].dict_link;
+
+		for (const auto &edge : nodes[node].edges) {
+			nodes[edge.second].fail = _step(fail, edge.first);
+			queue.push(edge.second);
+		}
+	}
+}
+
+void MessageFilter::compile(const PackedStringArray &p_patterns) {
+	nodes.clear();
+	nodes.emplace_back(); // root
+	keys.clear();
+	globs.clear();
+	unindexed_globs.clear();
+	match_all = false;
+
+	for (const String &pattern : p_patterns) {
+		_add_pattern(pattern);
+	}
+
+	_build_links();
+}
+
+bool MessageFilter::_check_key(const Key &p_key, int64_t p_end, const String &p_message) const {
+	int64_t start = p_end - p_key.length + 1;
+	int64_t last = p_message.length() - 1;
+	switch (p_key.kind) {
+		case RULE_EXACT:
+			return start == 0 && p_end == last;
+		case RULE_PREFIX:
+			return start == 0;
+		case RULE_SUFFIX:
+			return p_end == last;
+		case RULE_SUBSTRING:
+			return true;
+		case RULE_GLOB:
+			return p_message.match(globs[p_key.glob_index]);
+	}
+	return false;
+}
+
+bool MessageFilter::matches(const String &p_message) const {
+	if (match_all) {
+		return true;
+	}
+
+	if (!keys.empty()) {
+		const char32_t *ptr = p_message.ptr();
+		int64_t length = p_message.length();
+		int32_t node = 0;
+		for (int64_t i = 0; i < length; i++) {
+			node = _step(node, ptr[i]);
+			for (int32_t n = nodes[node].keys.empty() ? nodes[node].dict_link : node; n != -1; n = nodes[n].dict_link) {
+				for (int32_t key_index : nodes[n].keys) {
+					if (_check_key(keys[key_index], i, p_message)) {
+						return true;
+					}
+				}
+			}
+		}
+	}
+
+	for (const String &glob : unindexed_globs) {
+		if (p_message.match(glob)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} //namespace sentry::logging
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <vector>
+
+using namespace godot;
+
+namespace sentry::logging {
+
+// Matches messages against a set of glob patterns ("*" matches any sequence, "?" matches one character).
+//
+// Patterns are compiled into a single Aho-Corasick automaton over their literal parts,
+// so a message is scanned once, regardless of the number of patterns:
+// - "text*" (prefix), "*text*" (substring), "*text" (suffix) and "text" (exact) are matched by the automaton alone;
+// - other globs are only checked with String::match() when their longest literal part occurs in the message.
+// Immutable once compiled, so it can be used from multiple threads.
+class MessageFilter {
+private:
+	enum RuleKind {
+		RULE_EXACT,
+		RULE_PREFIX,
+		RULE_SUFFIX,
+		RULE_SUBSTRING,
+		RULE_GLOB,
+	};
+
+	struct Key {
+		int32_t length = 0;
+		RuleKind kind = RULE_EXACT;
+		int32_t glob_index = -1; // for RULE_GLOB
+	};
+
+	struct Node {
+		std::vector<std::pair<char32_t, int32_t>> edges; // sorted by character
+		int32_t fail = 0;
+		int32_t dict_link = -1; // nearest node on the failure chain with keys
+		std::vector<int32_t> keys; // keys ending at this node
+	};
+
+	std::vector<Node> nodes;
+	std::vector<Key> keys;
+	std::vector<String> globs;
+	std::vector<String> unindexed_globs; // globs without literal parts (e.g., "?*"), always checked
+	bool match_all = false;
+
+	int32_t _find_edge(int32_t p_node, char32_t p_char) const;
+	int32_t _step(int32_t p_node, char32_t p_char) const;
+	void _add_key(const String &p_literal, RuleKind p_kind, int32_t p_glob_index = -1);
+	void _add_pattern(const String &p_pattern);
+	void _build_links();
+	bool _check_key(const Key &p_key, int64_t p_end, const String &p_message) const;
+
+public:
+	void compile(const PackedStringArray &p_patterns);
+	bool matches(const String &p_message) const;
+	bool is_empty() const { return keys.empty() && unindexed_globs.empty() && !match_all; }
+};
+
+} //namespace sentry::logging
@@ -0,0 +1,166 @@
+#include "script_source_cache.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/util/hash.h"
+#include "sentry/util/text.h"
+
+#include <chrono>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/script.hpp>
+
+namespace sentry::logging {
+
+uint64_t ScriptSourceCache::_get_modified_time(const String &p_file) {
+	// Scripts exported to PCK (or remapped to binary tokens) don't change at runtime, so 0 is fine as a stamp.
+	if (!FileAccess::file_exists(p_file)) {
+		return 0;
+	}
+	return FileAccess::get_modified_time(p_file);
+}
+
+uint64_t ScriptSourceCache::_now_msec() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool ScriptSourceCache::_load_entry(const String &p_file, uint64_t p_modified_time, Entry &r_entry) {
+	if (!ResourceLoader::get_singleton()->exists(p_file)) {
+		return false;
+	}
+
+	Ref<Script> script = ResourceLoader::get_singleton()->load(p_file);
+
+	// ! Note: Script source code context is only automatically provided if GDScript is exported as text (not binary tokens).
+
+	if (script.is_null()) {
+		sentry::logging::print_error("Failed to load script ", p_file);
+		return false;
+	}
+
+	r_entry.path = p_file;
+	r_entry.modified_time = p_modified_time;
+	r_entry.validated_msec = _now_msec();
+	r_entry.source = script->get_source_code();
+
+	// Leave index empty if source is not available, so we don't try to load the script again.
+	if (!r_entry.source.is_empty()) {
+		const char32_t *ptr = r_entry.source.ptr();
+		int32_t length = r_entry.source.length();
+		r_entry.line_starts.push_back(0);
+		for (int32_t i = 0; i < length; i++) {
+			if (ptr[i] == '\n') {
+				r_entry.line_starts.push_back(i + 1);
+			}
+		}
+		r_entry.line_starts.push_back(length + 1);
+	}
+
+	r_entry.memory_bytes = sizeof(Entry) +
+			(r_entry.path.length() + r_entry.source.length()) * sizeof(char32_t) +
+			r_entry.line_starts.size() * sizeof(int32_t);
+	return true;
+}
+
+bool ScriptSourceCache::_store(uint64_t p_key, Entry &p_entry) {
+	if (p_entry.memory_bytes > MAX_MEMORY_BYTES) {
+		return false;
+	}
+
+	// Drop stale entry for the same key first to keep memory accounting right.
+	if (Entry *existing = entries.find(p_key)) {
+		memory_used -= existing->memory_bytes;
+		entries.erase(p_key);
+	}
+
+	while (!entries.is_empty() &&
+			(entries.size() == entries.capacity() || memory_used + p_entry.memory_bytes > MAX_MEMORY_BYTES)) {
+		memory_used -= entries.oldest()->memory_bytes;
+		entries.pop_oldest();
+	}
+
+	memory_used += p_entry.memory_bytes;
+	entries.put(p_key, std::move(p_entry));
+	return true;
+}
+
+bool ScriptSourceCache::get_context(const String &p_file, int p_line, String &r_context_line, PackedStringArray &r_pre_context, PackedStringArray &r_post_context) {
+	// Don't fetch C# context - fails to load and leads to errors.
+	if (p_file.is_empty() || sentry::util::ends_with_nocase_ascii(p_file, ".cs")) {
+		return false;
+	}
+
+	uint64_t key = sentry::util::fnv1a_hash64(p_file.ptr(), p_file.length());
+	uint64_t now_msec = _now_msec();
+
+	std::unique_lock lock{ mutex };
+
+	Entry *cached = entries.touch(key);
+	if (cached && cached->path == p_file && now_msec - cached->validated_msec >= REVALIDATE_INTERVAL_MSEC) {
+		// Filesystem access is done without holding the lock.
+		lock.unlock();
+		uint64_t modified_time = _get_modified_time(p_file);
+		lock.lock();
+		cached = entries.find(key);
+		if (cached && cached->path == p_file) {
+			if (cached->modified_time == modified_time) {
+				cached->validated_msec = now_msec;
+			} else {
+				cached = nullptr;
+			}
+		}
+	}
+
+	Entry loaded;
+	const Entry *entry = cached;
+	if (!entry || entry->path != p_file) {
+		// Loading may log errors that re-enter the logger, so it must be done without holding the lock.
+		lock.unlock();
+		if (!_load_entry(p_file, _get_modified_time(p_file), loaded)) {
+			return false;
+		}
+		lock.lock();
+		// If too big to be cached, use it just this once.
+		entry = _store(key, loaded) ? entries.find(key) : &loaded;
+	}
+
+	int num_lines = entry->num_lines();
+	if (num_lines == 0) {
+		lock.unlock();
+		sentry::logging::print_debug("Script source not available ", p_file.utf8().ptr());
+		return false;
+	}
+
+	if (p_line < 1 || num_lines < p_line) {
+		lock.unlock();
+		sentry::logging::print_error("Script source is smaller than the referenced line, lineno: ", p_line);
+		return false;
+	}
+
+	r_context_line = entry->get_line(p_line - 1);
+
+	int pre_start = MAX(p_line - 1 - CONTEXT_LINES, 0);
+	r_pre_context.resize(p_line - 1 - pre_start);
+	for (int i = pre_start; i < p_line - 1; i++) {
+		r_pre_context.set(i - pre_start, entry->get_line(i));
+	}
+
+	int post_end = MIN(p_line + CONTEXT_LINES, num_lines);
+	r_post_context.resize(post_end - p_line);
+	for (int i = p_line; i < post_end; i++) {
+		r_post_context.set(i - p_line, entry->get_line(i));
+	}
+
+	return true;
+}
+
+void ScriptSourceCache::clear() {
+	std::lock_guard lock{ mutex };
+	entries.clear();
+	memory_used = 0;
+}
+
+ScriptSourceCache::ScriptSourceCache() {
+	entries.reset(MAX_SCRIPTS);
+}
+
+} //namespace sentry::logging
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "sentry/util/lru_map.h"
+
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <mutex>
+#include <vector>
+
+using namespace godot;
+
+namespace sentry::logging {
+
+// Caches script sources together with an index of line start offsets, so that source context
+// for a stack frame can be sliced out without reloading and splitting the whole script every time.
+// Entries are keyed by script path and invalidated when the script's modification time changes
+// (i.e., when the script is saved and reloaded). The modification time is checked at most once per
+// REVALIDATE_INTERVAL_MSEC for each script, so repeated frames don't hit the filesystem.
+// Bounded by number of scripts and memory use.
+// Thread-safe: errors can be captured on any thread.
+class ScriptSourceCache {
+private:
+	static constexpr int32_t MAX_SCRIPTS = 64;
+	static constexpr size_t MAX_MEMORY_BYTES = 8 * 1024 * 1024;
+	static constexpr uint64_t REVALIDATE_INTERVAL_MSEC = 2000;
+
+	// Number of lines taken before and after the referenced line.
+	static constexpr int CONTEXT_LINES = 5;
+
+	struct Entry {
+		String path;
+		uint64_t modified_time = 0;
+		uint64_t validated_msec = 0;
+		String source;
+		// Offset of the first character of each line, followed by (source length + 1).
+		std::vector<int32_t> line_starts;
+		size_t memory_bytes = 0;
+
+		_FORCE_INLINE_ int num_lines() const { return line_starts.empty() ? 0 : int(line_starts.size()) - 1; }
+		_FORCE_INLINE_ String get_line(int p_index) const {
+			return source.substr(line_starts[p_index], line_starts[p_index + 1] - line_starts[p_index] - 1);
+		}
+	};
+
+	std::mutex mutex;
+	sentry::util::LRUMap<Entry> entries;
+	size_t memory_used = 0;
+
+	static uint64_t _get_modified_time(const String &p_file);
+	static uint64_t _now_msec();
+	static bool _load_entry(const String &p_file, uint64_t p_modified_time, Entry &r_entry);
+
+	// Moves the entry into the cache, evicting old entries as needed. Returns false if the entry is too big.
+	bool _store(uint64_t p_key, Entry &p_entry);
+
+public:
+	// Returns false if the script source is not available or the line is out of range.
+	bool get_context(const String &p_file, int p_line, String &r_context_line, PackedStringArray &r_pre_context, PackedStringArray &r_post_context);
+
+	void clear();
+
+	ScriptSourceCache();
+};
+
+} //namespace sentry::logging
@@ -8,12 +8,10 @@
 #include "sentry/util/hash.h"
 #include "sentry/util/recursion_guard.h"
 #include "sentry/util/text.h"
+#include "sentry/util/variant_budget.h"
 
 #include <godot_cpp/classes/engine.hpp>
-#include <godot_cpp/classes/resource_loader.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
-#include <godot_cpp/classes/script.hpp>
-#include <string_view>
 
 namespace {
 
@@ -28,48 +26,12 @@ const char *error_type_as_string[] = {
 	"SHADER ERROR",
 };
 
-bool _get_script_context(const String &p_file, int p_line, String &r_context_line, PackedStringArray &r_pre_context, PackedStringArray &r_post_context) {
-	// Don't fetch C# context - fails to load and leads to errors.
-	if (p_file.is_empty() || sentry::util::ends_with_nocase_ascii(p_file, ".cs")) {
-		return false;
-	}
-
-	if (!ResourceLoader::get_singleton()->exists(p_file)) {
-		return false;
-	}
-
-	Ref<Script> script = ResourceLoader::get_singleton()->load(p_file);
-
-	// ! Note: Script source code context is only automatically provided if GDScript is exported as text (not binary tokens).
-
-	if (script.is_null()) {
-		sentry::logging::print_error("Failed to load script ", p_file);
-		return false;
-	}
-
-	String source_code = script->get_source_code();
-	if (source_code.is_empty()) {
-		sentry::logging::print_debug("Script source not available ", p_file.utf8().ptr());
-		return false;
-	}
-
-	PackedStringArray lines = script->get_source_code().split("\n");
-	if (lines.size() < p_line) {
-		sentry::logging::print_error("Script source is smaller than the referenced line, lineno: ", p_line);
-		return false;
-	}
-
-	r_context_line = lines[p_line - 1];
-	r_pre_context = lines.slice(MAX(p_line - 6, 0), p_line - 1);
-	r_post_context = lines.slice(p_line, MIN(p_line + 5, lines.size()));
-	return true;
-}
-
 Vector<SentryEvent::StackFrame> _extract_error_stack_frames_from_backtraces(
 		const TypedArray<ScriptBacktrace> &p_backtraces,
 		const String &p_file,
 		int p_line,
-		bool p_include_variables) {
+		bool p_include_variables,
+		Vector<Pair<String, Variant>> &r_globals) {
 	Vector<SentryEvent::StackFrame> frames;
 
 	// Prioritize backtrace with the top frame matching the error's file and linenumber.
@@ -104,106 +66,73 @@ Vector<SentryEvent::StackFrame> _extract_error_stack_frames_from_backtraces(
 				platform
 			};
 
-			// Provide script source code context for script errors if available.
-			if (SENTRY_OPTIONS()->get_godot_logger()->get_include_source_context()) {
-				String context_line;
-				PackedStringArray pre_context;
-				PackedStringArray post_context;
-				bool success = _get_script_context(backtrace->get_frame_file(frame_idx),
-						backtrace->get_frame_line(frame_idx), context_line, pre_context, post_context);
-				if (success) {
-					stack_frame.context_line = context_line;
-					stack_frame.pre_context = pre_context;
-					stack_frame.post_context = post_context;
-				}
-			}
-
 			// Local and member variables.
 			if (p_include_variables) {
 				int32_t num_locals = backtrace->get_local_variable_count(frame_idx);
 				int32_t num_members = backtrace->get_member_variable_count(frame_idx);
-				int32_t num_globals = backtrace->get_global_variable_count();
-				int32_t num_vars = num_locals + num_members + num_globals;
-				int32_t starting_index = 0;
 
-				stack_frame.vars.resize(num_vars);
+				stack_frame.vars.resize(num_locals + num_members);
+				Pair<String, Variant> *vars_ptrw = stack_frame.vars.ptrw();
 
 				for (int i = 0; i < num_locals; i++) {
-					stack_frame.vars.set(starting_index + i,
-							Pair(backtrace->get_local_variable_name(frame_idx, i), backtrace->get_local_variable_value(frame_idx, i)));
+					*vars_ptrw++ = Pair(backtrace->get_local_variable_name(frame_idx, i), backtrace->get_local_variable_value(frame_idx, i));
 				}
-				starting_index += num_locals;
 
 				for (int i = 0; i < num_members; i++) {
-					stack_frame.vars.set(starting_index + i,
-							Pair(backtrace->get_member_variable_name(frame_idx, i), backtrace->get_member_variable_value(frame_idx, i)));
-				}
-				starting_index += num_members;
-
-				for (int i = 0; i < num_globals; i++) {
-					stack_frame.vars.set(starting_index + i,
-							Pair(backtrace->get_global_variable_name(i), backtrace->get_global_variable_value(i)));
+					*vars_ptrw++ = Pair(backtrace->get_member_variable_name(frame_idx, i), backtrace->get_member_variable_value(frame_idx, i));
 				}
 			}
 
 			frames.append(stack_frame);
 		}
+
+		// Global variables are the same for every frame – captured once per event.
+		if (p_include_variables) {
+			int32_t num_globals = backtrace->get_global_variable_count();
+			r_globals.resize(num_globals);
+			for (int i = 0; i < num_globals; i++) {
+				r_globals.set(i, Pair(backtrace->get_global_variable_name(i), backtrace->get_global_variable_value(i)));
+			}
+		}
 	}
 
 	return frames;
 }
 
-String _strip_invisible(const String &p_text) {
-	String result;
-
-	int i = 0;
-	int length = p_text.length();
-
-	while (i < length) {
-		char32_t c = p_text[i];
-
-		// Detect ANSI escape sequences: ESC (0x1B) + '['
-		if (c == 0x1B && i + 1 < length && p_text[i + 1] == '[') {
-			i += 2;
-			// Skip until we reach a final byte (0x40-0x7E) aka [A-Za-z0-9].
-			while (i < length) {
-				char32_t cc = p_text[i];
-				if (cc >= 0x40 && cc <= 0x7E) {
-					i++;
-					break;
-				}
-				i++;
-			}
+// Provides script source code context for script frames if available.
+void _add_source_context(Vector<SentryEvent::StackFrame> &p_frames, sentry::logging::ScriptSourceCache &p_cache) {
+	for (SentryEvent::StackFrame &frame : p_frames) {
+		if (!frame.in_app) {
 			continue;
 		}
-
-		// Skip control characters (ASCII < 0x20 or DEL 0x7F)
-		if (c < 0x20 || c == 0x7F) {
-			i++;
-			continue;
+		String context_line;
+		PackedStringArray pre_context;
+		PackedStringArray post_context;
+		bool success = p_cache.get_context(frame.filename, frame.lineno, context_line, pre_context, post_context);
+		if (success) {
+			frame.context_line = context_line;
+			frame.pre_context = pre_context;
+			frame.post_context = post_context;
 		}
-
-		result += c;
-		i++;
 	}
+}
 
-	return result;
+int64_t _usec_since_unix_epoch() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::system_clock::now().time_since_epoch())
+			.count();
 }
 
 } // unnamed namespace
 
 namespace sentry::logging {
 
-std::size_t SentryGodotLogger::ErrorKeyHash::operator()(const ErrorKey &p_key) const {
-	CharString message_cstr = p_key.message.utf8();
-	CharString filename_cstr = p_key.file.utf8();
-
-	std::string_view message_sv{ message_cstr.get_data() };
-	std::string_view filename_sv{ filename_cstr.get_data() };
-
-	size_t hash_value = sentry::util::hash(message_sv);
-	sentry::util::hash_combine(hash_value, filename_sv);
-	sentry::util::hash_combine(hash_value, p_key.line);
+SentryGodotLogger::ErrorFingerprint SentryGodotLogger::_make_error_fingerprint(const String &p_message, const String &p_file, int p_line) {
+	uint64_t hash_value = sentry::util::fnv1a_hash64(p_message.ptr(), p_message.length());
+	// Length acts as a separator, so that ("ab", "c") and ("a", "bc") don't collide.
+	hash_value = sentry::util::fnv1a_hash64(p_message.length(), hash_value);
+	hash_value = sentry::util::fnv1a_hash64(p_file.ptr(), p_file.length(), hash_value);
+	hash_value = sentry::util::fnv1a_hash64(static_cast<uint64_t>(p_line), hash_value);
 	return hash_value;
 }
 
@@ -248,9 +177,13 @@ void SentryGodotLogger::_process_frame() {
 		event_times.pop_front();
 	}
 
-	// Clear source_line_times if it's too big. Cheap and efficient.
-	if (unlikely(error_timepoints.size() > 100)) {
-		error_timepoints.clear();
+	// Forget error sources whose repeated error window has passed.
+	// Entries are ordered by the time they were logged, so only the oldest ones need checking.
+	while (TimePoint *oldest = error_timepoints.oldest()) {
+		if (now - *oldest < limits.repeated_error_window) {
+			break;
+		}
+		error_timepoints.pop_oldest();
 	}
 }
 
@@ -303,12 +236,8 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 	}
 
 	String error_message = p_rationale.is_empty() ? p_code : p_rationale;
-	String error_type = error_type_as_string[int(p_error_type)];
 
-	ErrorKey error_key;
-	error_key.message = error_message;
-	error_key.file = p_file;
-	error_key.line = p_line;
+	ErrorFingerprint fingerprint = _make_error_fingerprint(error_message, p_file, p_line);
 
 	TimePoint now = std::chrono::high_resolution_clock::now();
 
@@ -322,8 +251,8 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 		// Reject errors based on per-source-line throttling window to prevent
 		// repetitive logging caused by loops or errors recurring in each frame.
 		// The timestamps are tracked for each source line that produced an error.
-		auto it = error_timepoints.find(error_key);
-		bool is_spammy_error = it != error_timepoints.end() && now - it->second < limits.repeated_error_window;
+		TimePoint *last_logged = error_timepoints.find(fingerprint);
+		bool is_spammy_error = last_logged && now - *last_logged < limits.repeated_error_window;
 
 		bool within_frame_limit = frame_events < limits.events_per_frame;
 		bool within_throttling_limit = event_times.size() < limits.throttle_events || limits.throttle_window.count() == 0;
@@ -345,7 +274,7 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 
 		if (as_event || as_breadcrumb || as_log) {
 			// Store timestamp to prevent repetitive logging from the same line of code.
-			error_timepoints[error_key] = now;
+			error_timepoints.put(fingerprint, now);
 		}
 	}
 
@@ -354,53 +283,109 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 		return;
 	}
 
-	sentry::logging::print_debug(
-			"Capturing error: ", error_message,
-			"\n   at: ", p_function, " (", p_file, ":", p_line, ")",
-			"\n   event: ", as_event, "  breadcrumb: ", as_breadcrumb, "  log: ", as_log);
+	ErrorRecord record;
+	record.function = p_function;
+	record.file = p_file;
+	record.line = p_line;
+	record.code = p_code;
+	record.rationale = p_rationale;
+	record.error_type = (GodotErrorType)p_error_type;
+	record.as_event = as_event;
+	record.as_breadcrumb = as_breadcrumb;
+	record.as_log = as_log;
 
-	String event_uuid;
-
-	// Capture error as event.
 	if (as_event) {
+		// Script backtraces are only valid on this thread, so frames must be extracted right away.
 		// Backtraces don't include variables by default, so if we need them, we must capture them separately.
 		bool include_variables = SENTRY_OPTIONS()->get_godot_logger()->get_include_variables();
 		TypedArray<ScriptBacktrace> script_backtraces = include_variables
 				? Engine::get_singleton()->capture_script_backtraces(true)
 				: p_script_backtraces;
 
-		Vector<SentryEvent::StackFrame> frames = _extract_error_stack_frames_from_backtraces(
-				script_backtraces, p_file, p_line, include_variables);
+		record.frames = _extract_error_stack_frames_from_backtraces(
+				script_backtraces, p_file, p_line, include_variables, record.globals);
 
 		if (p_error_type == ErrorType::ERROR_TYPE_ERROR) {
 			// Add native frame to the top so it is preserved as the source of error.
-			frames.append({ p_file, p_function, p_line, false, "native" });
+			record.frames.append({ p_file, p_function, p_line, false, "native" });
+		}
+	}
+
+	// Errors raised by the worker itself are captured in place, so the feedback loop guard stays effective.
+	if (worker.joinable() && std::this_thread::get_id() != worker.get_id()) {
+		record.timestamp_usec = _usec_since_unix_epoch();
+		// Scopes belong to their thread – the worker gets a snapshot of the current one.
+		record.scope = SentrySDK::get_singleton()->get_current_scope()->clone();
+		// Script variables can change or be freed while the error waits in the queue,
+		// and objects can't be converted to strings on the worker.
+		for (SentryEvent::StackFrame &frame : record.frames) {
+			for (Pair<String, Variant> &var : frame.vars) {
+				var.second = sentry::util::snapshot_variant(var.second);
+			}
+		}
+		for (Pair<String, Variant> &var : record.globals) {
+			var.second = sentry::util::snapshot_variant(var.second);
+		}
+		if (_enqueue_error(std::move(record))) {
+			return;
+		}
+	} else {
+		record.scope = SentrySDK::get_singleton()->get_current_scope();
+	}
+
+	_capture_error(record);
+}
+
+void SentryGodotLogger::_capture_error(const ErrorRecord &p_record) {
+	if (!SentrySDK::get_singleton()) {
+		return;
+	}
+
+	String error_message = p_record.rationale.is_empty() ? p_record.code : p_record.rationale;
+	String error_type = error_type_as_string[int(p_record.error_type)];
+
+	sentry::logging::print_debug(
+			"Capturing error: ", error_message,
+			"\n   at: ", p_record.function, " (", p_record.file, ":", p_record.line, ")",
+			"\n   event: ", p_record.as_event, "  breadcrumb: ", p_record.as_breadcrumb, "  log: ", p_record.as_log);
+
+	String event_uuid;
+
+	// Capture error as event.
+	if (p_record.as_event) {
+		Vector<SentryEvent::StackFrame> frames = p_record.frames;
+		if (SENTRY_OPTIONS()->get_godot_logger()->get_include_source_context()) {
+			_add_source_context(frames, script_source_cache);
 		}
 
 		Ref<SentryEvent> ev = SentrySDK::get_singleton()->create_event();
-		ev->set_level(sentry::get_sentry_level_for_godot_error_type((GodotErrorType)p_error_type));
+		ev->set_level(sentry::get_sentry_level_for_godot_error_type(p_record.error_type));
+		if (p_record.timestamp_usec) {
+			ev->set_timestamp(SentryTimestamp::from_microseconds_since_unix_epoch(p_record.timestamp_usec));
+		}
 		SentryEvent::Exception exception = {
 			error_type,
 			error_message,
-			frames
+			frames,
+			p_record.globals
 		};
 		ev->add_exception(exception);
 		ev->set_logger(logger_name);
-		event_uuid = SentrySDK::get_singleton()->capture_event(ev);
+		event_uuid = INTERNAL_SDK()->capture_event(p_record.scope, ev);
 	}
 
 	// Capture error as breadcrumb.
-	if (as_breadcrumb) {
+	if (p_record.as_breadcrumb) {
 		Dictionary data;
-		data["function"] = p_function;
-		data["file"] = p_file;
-		data["line"] = p_line;
-		data["code"] = p_code;
-		data["rationale"] = p_rationale;
+		data["function"] = p_record.function;
+		data["file"] = p_record.file;
+		data["line"] = p_record.line;
+		data["code"] = p_record.code;
+		data["rationale"] = p_record.rationale;
 		data["error_type"] = error_type;
 
 		Ref<SentryBreadcrumb> crumb = SentryBreadcrumb::create(error_message);
-		crumb->set_level(sentry::get_sentry_level_for_godot_error_type((GodotErrorType)p_error_type));
+		crumb->set_level(sentry::get_sentry_level_for_godot_error_type(p_record.error_type));
 		crumb->set_type("error");
 		crumb->set_category("error");
 		crumb->set_data(data);
@@ -408,37 +393,109 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 	}
 
 	// Capture as structured log.
-	if (as_log) {
+	if (p_record.as_log) {
 		String body = vformat("%s: %s\n   at: %s (%s:%d)",
 				error_type,
 				error_message,
-				p_function,
-				p_file,
-				p_line);
-		if (as_event) {
+				p_record.function,
+				p_record.file,
+				p_record.line);
+		if (p_record.as_event) {
 			// TODO: Should just leave it as attribute?
 			body += "\n   event_id: " + event_uuid;
 		}
 
-		LogLevel log_level = sentry::get_sentry_log_level_for_godot_error_type((GodotErrorType)p_error_type);
+		LogLevel log_level = sentry::get_sentry_log_level_for_godot_error_type(p_record.error_type);
 
 		Dictionary attributes;
-		attributes["error.function"] = p_function;
-		attributes["error.file"] = p_file;
-		attributes["error.line"] = p_line;
+		attributes["error.function"] = p_record.function;
+		attributes["error.file"] = p_record.file;
+		attributes["error.line"] = p_record.line;
 		attributes["error.type"] = error_type;
 		if (!event_uuid.is_empty()) {
 			attributes["sentry.event_id"] = event_uuid;
 		}
-		if (!p_code.is_empty()) {
-			attributes["error.code"] = p_code;
+		if (!p_record.code.is_empty()) {
+			attributes["error.code"] = p_record.code;
+		}
+		if (!p_record.rationale.is_empty()) {
+			attributes["error.rationale"] = p_record.rationale;
+		}
+
+		SentrySDK::get_singleton()->get_logger()->capture(p_record.scope, log_level, body, attributes);
+	}
+}
+
+void SentryGodotLogger::_start_worker() {
+	int queue_size = MAX(1, SENTRY_OPTIONS()->get_godot_logger()->get_async_queue_size());
+	overflow_policy = SENTRY_OPTIONS()->get_godot_logger()->get_async_overflow_policy();
+
+	queue.resize(queue_size);
+	queue_head = 0;
+	queue_count = 0;
+	worker_should_stop = false;
+	worker = std::thread(&SentryGodotLogger::_worker_loop, this);
+}
+
+void SentryGodotLogger::_stop_worker() {
+	if (!worker.joinable()) {
+		return;
+	}
+
+	{
+		std::lock_guard lock{ queue_mutex };
+		worker_should_stop = true;
+	}
+	queue_cv.notify_one();
+
+	// The worker drains the remaining errors before exiting.
+	worker.join();
+}
+
+void SentryGodotLogger::_worker_loop() {
+	while (true) {
+		ErrorRecord record;
+		{
+			std::unique_lock lock{ queue_mutex };
+			queue_cv.wait(lock, [this] { return queue_count > 0 || worker_should_stop; });
+			if (queue_count == 0) {
+				// Stop requested and the queue is drained.
+				break;
+			}
+			record = std::move(queue[queue_head]);
+			queue[queue_head] = ErrorRecord();
+			queue_head = (queue_head + 1) % queue.size();
+			queue_count--;
 		}
-		if (!p_rationale.is_empty()) {
-			attributes["error.rationale"] = p_rationale;
+		_capture_error(record);
+	}
+}
+
+bool SentryGodotLogger::_enqueue_error(ErrorRecord &&p_record) {
+	{
+		std::lock_guard lock{ queue_mutex };
+
+		if (queue_count == queue.size()) {
+			switch (overflow_policy) {
+				case AsyncOverflowPolicy::OVERFLOW_DROP_NEWEST: {
+					return true;
+				} break;
+				case AsyncOverflowPolicy::OVERFLOW_DROP_OLDEST: {
+					queue[queue_head] = ErrorRecord();
+					queue_head = (queue_head + 1) % queue.size();
+					queue_count--;
+				} break;
+				case AsyncOverflowPolicy::OVERFLOW_CAPTURE_IMMEDIATELY: {
+					return false;
+				} break;
+			}
 		}
 
-		INTERNAL_SDK()->capture_log(SentrySDK::get_singleton()->get_current_scope(), log_level, body, attributes);
+		queue[(queue_head + queue_count) % queue.size()] = std::move(p_record);
+		queue_count++;
 	}
+	queue_cv.notify_one();
+	return true;
 }
 
 void SentryGodotLogger::_log_message(const String &p_message, bool p_error) {
@@ -463,23 +520,21 @@ void SentryGodotLogger::_log_message(const String &p_message, bool p_error) {
 		return;
 	}
 
-	String processed_message = _strip_invisible(p_message);
+	String processed_message = sentry::util::strip_invisible(p_message);
 
 	if (processed_message.is_empty()) {
 		// Don't add empty breadcrumb.
 		return;
 	}
 
-	// Filtering: Check message prefixes to skip certain messages (e.g., Sentry's own debug output).
-	for (const String &prefix : filter_by_prefix) {
-		if (processed_message.begins_with(prefix)) {
-			return;
-		}
+	// Filtering: Skip certain messages (e.g., Sentry's own debug output).
+	if (message_filter.matches(processed_message)) {
+		return;
 	}
 
 	if (as_log) {
 		sentry::LogLevel level = p_error ? LOG_LEVEL_ERROR : LOG_LEVEL_INFO;
-		INTERNAL_SDK()->capture_log(SentrySDK::get_singleton()->get_current_scope(), level, processed_message, log_attributes);
+		SentrySDK::get_singleton()->get_logger()->capture(SentrySDK::get_singleton()->get_current_scope(), level, processed_message, log_attributes);
 	}
 
 	if (as_breadcrumb) {
@@ -509,6 +564,7 @@ void SentryGodotLogger::_notification(int p_what) {
 		} break;
 		case NOTIFICATION_PREDELETE: {
 			_disconnect_process_frame();
+			_stop_worker();
 		} break;
 	}
 }
@@ -516,27 +572,32 @@ void SentryGodotLogger::_notification(int p_what) {
 SentryGodotLogger::SentryGodotLogger() {
 	logger_name = "SentryGodotLogger";
 
-	log_attributes["sentry.origin"] = "auto.log.godot";
+	Dictionary attributes;
+	attributes["sentry.origin"] = "auto.log.godot";
+	log_attributes = SentryAttributes::create(attributes);
 
 	// Filtering setup.
-	filter_by_prefix = {
-		// Sentry messages
-		"Sentry: "
-	};
+	PackedStringArray filters;
+	filters.append("Sentry: *"); // Sentry messages
+	filters.append_array(SENTRY_OPTIONS()->get_godot_logger()->get_message_filters());
+	message_filter.compile(filters);
 
 	// Limits.
+	error_timepoints.reset(SENTRY_OPTIONS()->get_godot_logger()->get_limits()->get_repeated_error_capacity());
 	if (!Engine::get_singleton() || Engine::get_singleton()->get_process_frames() < 10) {
 		// Apply special limits during application startup when higher error density is expected.
 		_apply_startup_limits();
 	} else {
 		_apply_normal_limits();
 	}
+
+	if (SENTRY_OPTIONS()->get_godot_logger()->get_async_capture()) {
+		_start_worker();
+	}
 }
 
 SentryGodotLogger::~SentryGodotLogger() {
-	if (!Engine::get_singleton()) {
-		return;
-	}
+	_stop_worker();
 }
 
 } //namespace sentry::logging
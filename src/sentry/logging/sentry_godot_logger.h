@@ -1,13 +1,22 @@
 #pragma once
 
 #include "sentry/godot_error_types.h"
+#include "sentry/logging/message_filter.h"
+#include "sentry/logging/script_source_cache.h"
+#include "sentry/sentry_attributes.h"
+#include "sentry/sentry_event.h"
+#include "sentry/sentry_options.h"
+#include "sentry/sentry_scope.h"
+#include "sentry/util/lru_map.h"
 
 #include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <godot_cpp/classes/logger.hpp>
 #include <godot_cpp/classes/script_backtrace.hpp>
 #include <mutex>
-#include <unordered_map>
+#include <thread>
+#include <vector>
 
 using namespace godot;
 
@@ -24,6 +33,10 @@ namespace sentry::logging {
  *
  * Features include throttling, repeated error suppression, and filtering to
  * ensure better performance and signal-to-noise ratio in Sentry.
+ *
+ * With asynchronous capture enabled, the logging thread only takes a snapshot
+ * of the error and pushes it to a bounded queue. A worker thread then turns
+ * the snapshot into an event, breadcrumb and/or log.
  */
 class SentryGodotLogger : public Logger {
 	GDCLASS(SentryGodotLogger, Logger);
@@ -31,9 +44,10 @@ class SentryGodotLogger : public Logger {
 private:
 	using GodotErrorType = sentry::GodotErrorType;
 	using TimePoint = std::chrono::high_resolution_clock::time_point;
+	using AsyncOverflowPolicy = SentryGodotLoggerOptions::AsyncOverflowPolicy;
 
 	String logger_name;
-	Dictionary log_attributes;
+	Ref<SentryAttributes> log_attributes;
 
 	struct Limits {
 		int events_per_frame;
@@ -42,24 +56,17 @@ private:
 		int throttle_events;
 	} limits;
 
-	struct ErrorKey {
-		String message;
-		String file;
-		int line;
+	// 64-bit fingerprint of the error message, file and line. Computed directly from
+	// the string data, so looking up a repeated error doesn't allocate.
+	using ErrorFingerprint = uint64_t;
 
-		bool operator==(const ErrorKey &p_other) const {
-			return message == p_other.message && file == p_other.file && line == p_other.line;
-		}
-	};
-
-	struct ErrorKeyHash {
-		std::size_t operator()(const ErrorKey &p_key) const;
-	};
+	static ErrorFingerprint _make_error_fingerprint(const String &p_message, const String &p_file, int p_line);
 
 	std::mutex error_mutex;
 
 	// Stores the last time an error was logged for each source line that generated an error.
-	std::unordered_map<ErrorKey, TimePoint, ErrorKeyHash> error_timepoints;
+	// Bounded by capacity: once full, the least recently logged source is forgotten.
+	sentry::util::LRUMap<TimePoint> error_timepoints;
 
 	// Time points for events captured within throttling window.
 	std::deque<TimePoint> event_times;
@@ -67,8 +74,44 @@ private:
 	// Number of events captured during this frame.
 	int frame_events = 0;
 
-	// Filter: Remove messages from breadcrumbs which start with any of these prefixes.
-	std::vector<String> filter_by_prefix;
+	// Script sources with line indexes, used to add source context to stack frames.
+	ScriptSourceCache script_source_cache;
+
+	// Filter: Skip messages matching built-in and user-configured patterns.
+	MessageFilter message_filter;
+
+	// Snapshot of a logged error that passed the limits, with everything needed to capture it later.
+	struct ErrorRecord {
+		String function;
+		String file;
+		int32_t line = 0;
+		String code;
+		String rationale;
+		GodotErrorType error_type = GodotErrorType::ERROR_TYPE_ERROR;
+		bool as_event = false;
+		bool as_breadcrumb = false;
+		bool as_log = false;
+		int64_t timestamp_usec = 0; // Only set for queued errors.
+		Vector<SentryEvent::StackFrame> frames;
+		Vector<Pair<String, Variant>> globals;
+		Ref<SentryScope> scope;
+	};
+
+	// Asynchronous capture: fixed-size ring buffer of errors waiting for the worker thread.
+	std::vector<ErrorRecord> queue;
+	size_t queue_head = 0;
+	size_t queue_count = 0;
+	AsyncOverflowPolicy overflow_policy = AsyncOverflowPolicy::OVERFLOW_DROP_NEWEST;
+	bool worker_should_stop = false;
+	std::mutex queue_mutex;
+	std::condition_variable queue_cv;
+	std::thread worker;
+
+	void _start_worker();
+	void _stop_worker();
+	void _worker_loop();
+	bool _enqueue_error(ErrorRecord &&p_record);
+	void _capture_error(const ErrorRecord &p_record);
 
 	void _connect_process_frame();
 	void _disconnect_process_frame();
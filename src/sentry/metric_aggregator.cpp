@@ -0,0 +1,157 @@
+#include "metric_aggregator.h"
+
+#include "sentry/util/hash.h"
+
+#include <vector>
+
+namespace sentry {
+
+uint64_t MetricAggregator::_make_key(SentryMetric::MetricType p_type, const String &p_name, const String &p_unit, uint64_t p_attributes_hash) {
+	uint64_t key = util::fnv1a_hash64(p_name.ptr(), p_name.length());
+	// Length acts as a separator, so that name and unit boundaries don't collide.
+	key = util::fnv1a_hash64(p_name.length(), key);
+	key = util::fnv1a_hash64(p_unit.ptr(), p_unit.length(), key);
+	key = util::fnv1a_hash64(static_cast<uint64_t>(p_type), key);
+	return util::fnv1a_hash64(p_attributes_hash, key);
+}
+
+void MetricAggregator::Entry::add_value(double p_value) {
+	if (count == 0) {
+		min = p_value;
+		max = p_value;
+	} else {
+		min = MIN(min, p_value);
+		max = MAX(max, p_value);
+	}
+	count++;
+	value_sum += p_value;
+	last = p_value;
+}
+
+MetricAggregator::Entry *MetricAggregator::_get_entry(Shard &p_shard, uint64_t p_key, SentryMetric::MetricType p_type, const String &p_name, const String &p_unit, const Dictionary &p_attributes) {
+	auto it = p_shard.entries.find(p_key);
+	if (it != p_shard.entries.end()) {
+		Entry &entry = it->second;
+		// On hash collision, the metric is sent directly.
+		if (entry.type != p_type || entry.name != p_name || entry.unit != p_unit) {
+			return nullptr;
+		}
+		return &entry;
+	}
+
+	if (p_shard.entries.size() >= MAX_KEYS_PER_SHARD) {
+		return nullptr;
+	}
+
+	Entry &entry = p_shard.entries[p_key];
+	entry.type = p_type;
+	entry.name = p_name;
+	entry.unit = p_unit;
+	entry.attributes = p_attributes.duplicate();
+	return &entry;
+}
+
+bool MetricAggregator::add_count(const String &p_name, int64_t p_value, const Dictionary &p_attributes, uint64_t p_attributes_hash) {
+	uint64_t key = _make_key(SentryMetric::METRIC_COUNTER, p_name, String(), p_attributes_hash);
+	Shard &shard = shards[key % SHARD_COUNT];
+	std::lock_guard lock{ shard.mutex };
+
+	Entry *entry = _get_entry(shard, key, SentryMetric::METRIC_COUNTER, p_name, String(), p_attributes);
+	if (!entry) {
+		return false;
+	}
+	entry->count++;
+	entry->sum += p_value;
+	return true;
+}
+
+bool MetricAggregator::add_gauge(const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes, uint64_t p_attributes_hash) {
+	uint64_t key = _make_key(SentryMetric::METRIC_GAUGE, p_name, p_unit, p_attributes_hash);
+	Shard &shard = shards[key % SHARD_COUNT];
+	std::lock_guard lock{ shard.mutex };
+
+	Entry *entry = _get_entry(shard, key, SentryMetric::METRIC_GAUGE, p_name, p_unit, p_attributes);
+	if (!entry) {
+		return false;
+	}
+	entry->add_value(p_value);
+	return true;
+}
+
+bool MetricAggregator::add_distribution(const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes, uint64_t p_attributes_hash) {
+	uint64_t key = _make_key(SentryMetric::METRIC_DISTRIBUTION, p_name, p_unit, p_attributes_hash);
+	Shard &shard = shards[key % SHARD_COUNT];
+	std::lock_guard lock{ shard.mutex };
+
+	Entry *entry = _get_entry(shard, key, SentryMetric::METRIC_DISTRIBUTION, p_name, p_unit, p_attributes);
+	if (!entry) {
+		return false;
+	}
+	entry->add_value(p_value);
+	return true;
+}
+
+bool MetricAggregator::try_start_flush(uint64_t p_now_msec, uint64_t p_interval_msec) {
+	uint64_t last = last_flush_msec.load(std::memory_order_relaxed);
+	if (last == 0) {
+		last_flush_msec.compare_exchange_strong(last, p_now_msec, std::memory_order_relaxed);
+		return false;
+	}
+	if (p_now_msec - last < p_interval_msec) {
+		return false;
+	}
+	return last_flush_msec.compare_exchange_strong(last, p_now_msec, std::memory_order_relaxed);
+}
+
+void MetricAggregator::_emit_entry(Entry &p_entry, const EmitFunc &p_emit) {
+	// Entry owns its attributes, so the summary is added in place.
+	switch (p_entry.type) {
+		case SentryMetric::METRIC_COUNTER: {
+			p_emit(Item{ p_entry.type, p_entry.name, p_entry.unit, p_entry.attributes, p_entry.sum, double(p_entry.sum) });
+		} break;
+		case SentryMetric::METRIC_GAUGE: {
+			p_entry.attributes[ATTRIBUTE_COUNT] = p_entry.count;
+			p_entry.attributes[ATTRIBUTE_MIN] = p_entry.min;
+			p_entry.attributes[ATTRIBUTE_MAX] = p_entry.max;
+			p_emit(Item{ p_entry.type, p_entry.name, p_entry.unit, p_entry.attributes, 1, p_entry.last });
+		} break;
+		case SentryMetric::METRIC_DISTRIBUTION: {
+			p_entry.attributes[ATTRIBUTE_COUNT] = p_entry.count;
+			p_entry.attributes[ATTRIBUTE_SUM] = p_entry.value_sum;
+			p_entry.attributes[ATTRIBUTE_MIN] = p_entry.min;
+			p_entry.attributes[ATTRIBUTE_MAX] = p_entry.max;
+			p_emit(Item{ p_entry.type, p_entry.name, p_entry.unit, p_entry.attributes, 1, p_entry.value_sum / p_entry.count });
+		} break;
+	}
+}
+
+void MetricAggregator::flush(const EmitFunc &p_emit) {
+	std::vector<Entry> pending;
+	for (Shard &shard : shards) {
+		std::unordered_map<uint64_t, Entry> entries;
+		{
+			std::lock_guard lock{ shard.mutex };
+			entries.swap(shard.entries);
+		}
+		pending.reserve(pending.size() + entries.size());
+		for (auto &kv : entries) {
+			pending.push_back(std::move(kv.second));
+		}
+	}
+
+	for (Entry &entry : pending) {
+		_emit_entry(entry, p_emit);
+	}
+}
+
+bool MetricAggregator::is_empty() {
+	for (Shard &shard : shards) {
+		std::lock_guard lock{ shard.mutex };
+		if (!shard.entries.empty()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace sentry
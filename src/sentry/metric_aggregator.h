@@ -0,0 +1,94 @@
+#pragma once
+
+#include "sentry/sentry_metric.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <mutex>
+#include <unordered_map>
+
+using namespace godot;
+
+namespace sentry {
+
+// Aggregates metrics in memory so that frequently emitted metrics are sent once per flush interval
+// instead of once per call. Metrics are keyed by type, name, unit and attributes:
+// - Counters are summed.
+// - Gauges keep the last value, along with the minimum, maximum and number of values.
+// - Distributions keep a summary of count, sum, minimum and maximum, and are sent as their average.
+// Summaries are sent as attributes (see ATTRIBUTE_*), so memory per key stays constant.
+// Keys are spread across independently locked shards to reduce contention between threads.
+// Thread-safe.
+class MetricAggregator {
+public:
+	static constexpr int SHARD_COUNT = 8;
+	static constexpr int MAX_KEYS_PER_SHARD = 256;
+
+	static constexpr const char *ATTRIBUTE_COUNT = "sentry.godot.aggregate.count";
+	static constexpr const char *ATTRIBUTE_SUM = "sentry.godot.aggregate.sum";
+	static constexpr const char *ATTRIBUTE_MIN = "sentry.godot.aggregate.min";
+	static constexpr const char *ATTRIBUTE_MAX = "sentry.godot.aggregate.max";
+
+	struct Item {
+		SentryMetric::MetricType type;
+		const String &name;
+		const String &unit;
+		const Dictionary &attributes;
+		int64_t count_value; // for counters
+		double value; // last value for gauges, average for distributions
+	};
+
+	using EmitFunc = std::function<void(const Item &)>;
+
+private:
+	struct Entry {
+		SentryMetric::MetricType type = SentryMetric::METRIC_COUNTER;
+		String name;
+		String unit;
+		Dictionary attributes;
+
+		int64_t count = 0; // number of recorded values
+		int64_t sum = 0; // counters
+		double last = 0.0; // gauges
+		double value_sum = 0.0; // distributions
+		double min = 0.0; // gauges and distributions
+		double max = 0.0; // gauges and distributions
+
+		void add_value(double p_value);
+	};
+
+	struct Shard {
+		std::mutex mutex;
+		std::unordered_map<uint64_t, Entry> entries;
+	};
+
+	std::array<Shard, SHARD_COUNT> shards;
+	std::atomic<uint64_t> last_flush_msec{ 0 };
+
+	static uint64_t _make_key(SentryMetric::MetricType p_type, const String &p_name, const String &p_unit, uint64_t p_attributes_hash);
+
+	// Returns entry for the key, or nullptr if the shard is full. Shard lock must be held.
+	static Entry *_get_entry(Shard &p_shard, uint64_t p_key, SentryMetric::MetricType p_type, const String &p_name, const String &p_unit, const Dictionary &p_attributes);
+	static void _emit_entry(Entry &p_entry, const EmitFunc &p_emit);
+
+public:
+	// Each function returns false if the metric can't be aggregated and should be sent directly.
+	// Attributes are identified by p_attributes_hash (see SentryAttributes::hash_dictionary()).
+	bool add_count(const String &p_name, int64_t p_value, const Dictionary &p_attributes, uint64_t p_attributes_hash);
+	bool add_gauge(const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes, uint64_t p_attributes_hash);
+	bool add_distribution(const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes, uint64_t p_attributes_hash);
+
+	// Checks if the interval since the last flush has elapsed, and restarts it if so.
+	bool try_start_flush(uint64_t p_now_msec, uint64_t p_interval_msec);
+
+	// Passes aggregated metrics to p_emit and clears them. Called outside of shard locks.
+	void flush(const EmitFunc &p_emit);
+
+	bool is_empty();
+};
+
+} // namespace sentry
@@ -35,11 +35,7 @@ void sentry_event_merge_context(sentry_value_t p_event, const char *p_context_na
 	sentry_value_t ctx = sentry_value_get_by_key(contexts, p_context_name);
 	if (!sentry_value_is_null(ctx)) {
 		// If context exists, update it with new values.
-		const Array &updated_keys = p_context.keys();
-		for (int i = 0; i < updated_keys.size(); i++) {
-			const Variant &key = updated_keys[i];
-			sentry_value_set_by_key(ctx, key.stringify().utf8(), sentry::native::variant_to_sentry_value(p_context[key]));
-		}
+		sentry::native::sentry_value_set_from_dictionary(ctx, p_context);
 	} else {
 		// If context doesn't exist, add it.
 		sentry_value_set_by_key(contexts, p_context_name, sentry::native::variant_to_sentry_value(p_context));
@@ -226,6 +222,7 @@ void NativeEvent::merge_context(const String &p_key, const Dictionary &p_value)
 
 void NativeEvent::add_exception(const Exception &p_exception) {
 	sentry_value_t frames = sentry_value_new_list();
+	bool has_variables = false;
 
 	for (const StackFrame &frame : p_exception.frames) {
 		sentry_value_t sentry_frame = sentry_value_new_object();
@@ -239,16 +236,15 @@ void NativeEvent::add_exception(const Exception &p_exception) {
 			sentry_value_set_by_key(sentry_frame, "pre_context", sentry::native::strings_to_sentry_list(frame.pre_context));
 			sentry_value_set_by_key(sentry_frame, "post_context", sentry::native::strings_to_sentry_list(frame.post_context));
 		}
-		if (frame.vars.size() > 0) {
-			sentry_value_t vars = sentry_value_new_object();
-			sentry_value_set_by_key(sentry_frame, "vars", vars);
-			for (auto pair : frame.vars) {
-				sentry_value_set_by_key(vars, pair.first.utf8(), sentry::native::variant_to_sentry_value(pair.second));
-			}
-		}
+		has_variables = has_variables || !frame.vars.is_empty();
 		sentry_value_append(frames, sentry_frame);
 	}
 
+	if (has_variables || !p_exception.globals.is_empty()) {
+		sentry_value_incref(frames);
+		deferred_variables.push_back({ frames, p_exception });
+	}
+
 	sentry_value_t stack_trace = sentry_value_new_object();
 	sentry_value_set_by_key(stack_trace, "frames", frames);
 
@@ -271,6 +267,25 @@ void NativeEvent::add_exception(const Exception &p_exception) {
 	sentry_event_add_exception(native_event, native_exception);
 }
 
+void NativeEvent::serialize_deferred_variables() {
+	for (const DeferredVariables &deferred : deferred_variables) {
+		const Exception &exception = deferred.exception;
+		for (int i = 0; i < exception.frames.size(); i++) {
+			Vector<Pair<String, Variant>> frame_vars = exception.get_frame_variables(i);
+			if (frame_vars.is_empty()) {
+				continue;
+			}
+			sentry_value_t vars = sentry_value_new_object();
+			for (const Pair<String, Variant> &pair : frame_vars) {
+				sentry_value_set_by_key(vars, pair.first.utf8(), sentry::native::variant_to_sentry_value(pair.second));
+			}
+			sentry_value_set_by_key(sentry_value_get_by_index(deferred.frames, i), "vars", vars);
+		}
+		sentry_value_decref(deferred.frames);
+	}
+	deferred_variables.clear();
+}
+
 int NativeEvent::get_exception_count() const {
 	sentry_value_t exception = sentry_value_get_by_key(native_event, "exception");
 	sentry_value_t values = sentry_value_get_by_key(exception, "values");
@@ -330,6 +345,9 @@ NativeEvent::NativeEvent() {
 }
 
 NativeEvent::~NativeEvent() {
+	for (const DeferredVariables &deferred : deferred_variables) {
+		sentry_value_decref(deferred.frames);
+	}
 	sentry_value_decref(native_event); // release ownership
 }
 
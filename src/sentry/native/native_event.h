@@ -3,6 +3,7 @@
 #include "sentry/sentry_event.h"
 
 #include <sentry.h>
+#include <vector>
 
 namespace sentry::native {
 
@@ -14,12 +15,22 @@ private:
 	sentry_value_t native_event;
 	bool _is_crash = false;
 
+	// Frame variables are kept as captured until the event is about to be sent.
+	struct DeferredVariables {
+		sentry_value_t frames; // Frame list inside the event (we hold a reference).
+		Exception exception;
+	};
+	std::vector<DeferredVariables> deferred_variables;
+
 protected:
 	static void _bind_methods() {}
 
 public:
 	sentry_value_t get_native_value() const { return native_event; }
 
+	// Serializes variables of added exceptions into their stack frames.
+	void serialize_deferred_variables();
+
 	virtual String get_id() const override;
 
 	virtual void set_message(const String &p_message) override;
@@ -31,7 +31,19 @@ using NativeEvent = sentry::native::NativeEvent;
 using NativeLog = sentry::native::NativeLog;
 using NativeMetric = sentry::native::NativeMetric;
 
+// Event being captured on this thread by NativeSDK::capture_event().
+thread_local NativeEvent *capturing_event = nullptr;
+
+// Original timestamp of the log being captured on this thread by NativeSDK::capture_log_at(), or 0.
+thread_local double capturing_log_timestamp = 0.0;
+
 sentry_value_t _handle_before_send(sentry_value_t event, void *hint, void *closure) {
+	// Events that reach this point weren't sampled out, so it's worth serializing frame variables.
+	// Done before processing, so that before_send can inspect and scrub them.
+	if (capturing_event && capturing_event->get_native_value()._bits == event._bits) {
+		capturing_event->serialize_deferred_variables();
+	}
+
 	Ref<NativeEvent> event_obj = memnew(NativeEvent(event, false));
 	Ref<NativeEvent> processed = sentry::process_event(event_obj);
 
@@ -58,6 +70,15 @@ sentry_value_t _handle_before_send_feedback(sentry_value_t p_feedback, sentry_hi
 }
 
 sentry_value_t _handle_before_send_log(sentry_value_t p_value, void *p_user_data) {
+	// Batched logs keep the time they were created rather than when they are sent.
+	if (capturing_log_timestamp > 0.0) {
+		sentry_value_set_by_key(p_value, "timestamp", sentry_value_new_double(capturing_log_timestamp));
+	}
+
+	if (SENTRY_OPTIONS()->get_before_send_log().is_null()) {
+		return p_value;
+	}
+
 	Ref<NativeLog> log_obj = memnew(NativeLog(p_value));
 	Ref<NativeLog> processed = sentry::process_log(log_obj);
 
@@ -142,11 +163,20 @@ void _log_native_message(sentry_level_t level, const char *message, va_list args
 	constexpr char warning_prefix[] = "failed to read envelope item from";
 	constexpr size_t warning_prefix_len = sizeof(warning_prefix) - 1;
 	if (_cstring_begins_with(buffer, required, warning_prefix, warning_prefix_len)) {
-		constexpr char screenshot_suffix[] = "screenshot.jpg\"";
+		constexpr char screenshot_suffix[] = SENTRY_SCREENSHOT_FN "\"";
 		constexpr size_t screenshot_len = sizeof(screenshot_suffix) - 1;
+		constexpr char png_screenshot_suffix[] = SENTRY_SCREENSHOT_PNG_FN "\"";
+		constexpr size_t png_screenshot_len = sizeof(png_screenshot_suffix) - 1;
+		constexpr char webp_screenshot_suffix[] = SENTRY_SCREENSHOT_WEBP_FN "\"";
+		constexpr size_t webp_screenshot_len = sizeof(webp_screenshot_suffix) - 1;
+		constexpr char history_suffix[] = SENTRY_FRAME_HISTORY_FN "\"";
+		constexpr size_t history_len = sizeof(history_suffix) - 1;
 		constexpr char vh_suffix[] = "view-hierarchy.json\"";
 		constexpr size_t vh_len = sizeof(vh_suffix) - 1;
 		if (_cstring_ends_with(buffer, required, screenshot_suffix, screenshot_len) ||
+				_cstring_ends_with(buffer, required, png_screenshot_suffix, png_screenshot_len) ||
+				_cstring_ends_with(buffer, required, webp_screenshot_suffix, webp_screenshot_len) ||
+				_cstring_ends_with(buffer, required, history_suffix, history_len) ||
 				_cstring_ends_with(buffer, required, vh_suffix, vh_len)) {
 			accepted = false;
 		}
@@ -245,6 +275,29 @@ void NativeSDK::capture_log(const Ref<SentryScope> &p_scope, LogLevel p_level, c
 			p_body.utf8(), dictionary_to_attributes(p_attributes));
 }
 
+void NativeSDK::capture_log_compiled(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Ref<SentryAttributes> &p_attributes) {
+	if (p_body.is_empty()) {
+		return;
+	}
+
+	ERR_FAIL_COND(p_scope.is_null());
+	NativeScope *native_scope = static_cast<NativeScope *>(p_scope->get_implementation());
+
+	sentry_scope_capture_log(native_scope->get_native_scope(), _log_level_to_native(p_level),
+			p_body.utf8(), compiled_attributes_to_native(p_attributes));
+}
+
+void NativeSDK::capture_log_at(const Ref<SentryScope> &p_scope, double p_timestamp, LogLevel p_level, const String &p_body, const Dictionary &p_attributes, const Ref<SentryAttributes> &p_compiled) {
+	// Applied in _handle_before_send_log(), which sentry-native calls on this thread.
+	capturing_log_timestamp = p_timestamp;
+	if (p_compiled.is_valid()) {
+		capture_log_compiled(p_scope, p_level, p_body, p_compiled);
+	} else {
+		capture_log(p_scope, p_level, p_body, p_attributes);
+	}
+	capturing_log_timestamp = 0.0;
+}
+
 String NativeSDK::get_last_event_id() {
 	last_uuid_mutex->lock();
 	String uuid_str = _uuid_as_string(last_uuid);
@@ -270,7 +323,9 @@ String NativeSDK::capture_event(const Ref<SentryScope> &p_scope, const Ref<Sentr
 	sentry_value_t event = native_event->get_native_value();
 	sentry_value_incref(event); // Keep ownership.
 
+	capturing_event = native_event;
 	sentry_uuid_t uuid = sentry_scope_capture_event(native_scope->get_native_scope(), event);
+	capturing_event = nullptr;
 
 	last_uuid_mutex->lock();
 	last_uuid = uuid;
@@ -377,6 +432,30 @@ void NativeSDK::metrics_add_distribution(const Ref<SentryScope> &p_scope, const
 			p_name.utf8(), sentry_value_new_double(p_value), p_unit.utf8(), dictionary_to_attributes(p_attributes));
 }
 
+void NativeSDK::metrics_add_count_compiled(const Ref<SentryScope> &p_scope, const String &p_name, int64_t p_value, const Ref<SentryAttributes> &p_attributes) {
+	ERR_FAIL_COND(p_scope.is_null());
+	NativeScope *native_scope = static_cast<NativeScope *>(p_scope->get_implementation());
+
+	sentry_scope_capture_metric(native_scope->get_native_scope(), SENTRY_METRIC_COUNT,
+			p_name.utf8(), sentry_value_new_int64(p_value), nullptr, compiled_attributes_to_native(p_attributes));
+}
+
+void NativeSDK::metrics_add_gauge_compiled(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Ref<SentryAttributes> &p_attributes) {
+	ERR_FAIL_COND(p_scope.is_null());
+	NativeScope *native_scope = static_cast<NativeScope *>(p_scope->get_implementation());
+
+	sentry_scope_capture_metric(native_scope->get_native_scope(), SENTRY_METRIC_GAUGE,
+			p_name.utf8(), sentry_value_new_double(p_value), p_unit.utf8(), compiled_attributes_to_native(p_attributes));
+}
+
+void NativeSDK::metrics_add_distribution_compiled(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Ref<SentryAttributes> &p_attributes) {
+	ERR_FAIL_COND(p_scope.is_null());
+	NativeScope *native_scope = static_cast<NativeScope *>(p_scope->get_implementation());
+
+	sentry_scope_capture_metric(native_scope->get_native_scope(), SENTRY_METRIC_DISTRIBUTION,
+			p_name.utf8(), sentry_value_new_double(p_value), p_unit.utf8(), compiled_attributes_to_native(p_attributes));
+}
+
 void NativeSDK::set_attribute(const String &p_name, const Variant &p_value) {
 	sentry_set_attribute(p_name.utf8(), variant_to_attribute(p_value));
 }
@@ -467,10 +546,8 @@ void NativeSDK::init() {
 	sentry_options_set_on_crash(options, _handle_on_crash, NULL);
 	sentry_options_set_logger(options, _log_native_message, NULL);
 
-	const Callable &before_send_log = SENTRY_OPTIONS()->get_before_send_log();
-	if (before_send_log.is_valid()) {
-		sentry_options_set_before_send_log(options, _handle_before_send_log, NULL);
-	}
+	// Always installed, so that batched logs keep their original timestamps.
+	sentry_options_set_before_send_log(options, _handle_before_send_log, NULL);
 
 	const Callable &before_send_metric = SENTRY_OPTIONS()->get_before_send_metric();
 	if (before_send_metric.is_valid()) {
@@ -29,6 +29,8 @@ public:
 	virtual void add_breadcrumb(const Ref<SentryBreadcrumb> &p_breadcrumb) override;
 
 	virtual void capture_log(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes = Dictionary()) override;
+	virtual void capture_log_compiled(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Ref<SentryAttributes> &p_attributes) override;
+	virtual void capture_log_at(const Ref<SentryScope> &p_scope, double p_timestamp, LogLevel p_level, const String &p_body, const Dictionary &p_attributes, const Ref<SentryAttributes> &p_compiled) override;
 
 	virtual String get_last_event_id() override;
 
@@ -44,6 +46,10 @@ public:
 	virtual void metrics_add_gauge(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) override;
 	virtual void metrics_add_distribution(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) override;
 
+	virtual void metrics_add_count_compiled(const Ref<SentryScope> &p_scope, const String &p_name, int64_t p_value, const Ref<SentryAttributes> &p_attributes) override;
+	virtual void metrics_add_gauge_compiled(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Ref<SentryAttributes> &p_attributes) override;
+	virtual void metrics_add_distribution_compiled(const Ref<SentryScope> &p_scope, const String &p_name, double p_value, const String &p_unit, const Ref<SentryAttributes> &p_attributes) override;
+
 	virtual void set_attribute(const String &p_name, const Variant &p_value) override;
 	virtual void remove_attribute(const String &p_name) override;
 
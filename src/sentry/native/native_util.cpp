@@ -2,72 +2,172 @@
 
 #include "sentry/common_defs.h"
 
+#include <godot_cpp/templates/hash_map.hpp>
+
 namespace sentry::native {
 
-sentry_value_t variant_to_sentry_value(const Variant &p_variant, int p_depth) {
-	switch (p_variant.get_type()) {
-		case Variant::Type::NIL: {
-			return sentry_value_new_null();
-		} break;
-		case Variant::Type::BOOL: {
-			return sentry_value_new_bool((bool)p_variant);
-		} break;
-		case Variant::Type::INT: {
-			return sentry_value_new_int64((int64_t)p_variant);
-		} break;
-		case Variant::Type::FLOAT: {
-			return sentry_value_new_double((double)p_variant);
-		} break;
-		case Variant::Type::STRING: {
-			return sentry_value_new_string(((String)p_variant).utf8());
-		} break;
-		case Variant::Type::DICTIONARY: {
-			if (p_depth > VARIANT_CONVERSION_MAX_DEPTH) {
-				ERR_PRINT_ONCE("Sentry: Maximum Variant conversion depth reached!");
-				return sentry_value_new_string("{...}");
-			}
-
-			Dictionary dic = p_variant;
-			sentry_value_t sentry_dic = sentry_value_new_object();
-			const Array &keys = dic.keys();
-			for (int i = 0; i < keys.size(); i++) {
-				const Variant &key = keys[i];
-				sentry_value_set_by_key(sentry_dic, key.stringify().utf8(), variant_to_sentry_value(dic[key], p_depth + 1));
-			}
-			return sentry_dic;
-		} break;
-		case Variant::Type::ARRAY:
-		case Variant::Type::PACKED_BYTE_ARRAY:
-		case Variant::Type::PACKED_INT32_ARRAY:
-		case Variant::Type::PACKED_INT64_ARRAY:
-		case Variant::Type::PACKED_FLOAT32_ARRAY:
-		case Variant::Type::PACKED_FLOAT64_ARRAY:
-		case Variant::Type::PACKED_STRING_ARRAY:
-		case Variant::Type::PACKED_VECTOR2_ARRAY:
-		case Variant::Type::PACKED_VECTOR3_ARRAY:
-		case Variant::Type::PACKED_COLOR_ARRAY:
-		case Variant::Type::PACKED_VECTOR4_ARRAY: {
-			if (p_depth > VARIANT_CONVERSION_MAX_DEPTH) {
-				ERR_PRINT_ONCE("Sentry: Maximum Variant conversion depth reached!");
-				return sentry_value_new_string("[...]");
-			}
-
-			bool oob = false;
-			bool valid = true;
-			int i = 0;
-			sentry_value_t sentry_list = sentry_value_new_list();
-			do {
-				Variant item = p_variant.get_indexed(i++, valid, oob);
-				if (valid) {
-					sentry_value_append(sentry_list, variant_to_sentry_value(item, p_depth + 1));
+namespace {
+
+// Converts Variant trees to sentry values.
+// Caches UTF-8 of StringName keys, which usually repeat across dictionaries in the same tree.
+class VariantConverter {
+private:
+	HashMap<StringName, CharString> name_keys;
+
+	template <typename T, typename F>
+	static sentry_value_t _packed_to_list(const T &p_array, F p_convert) {
+		sentry_value_t sentry_list = sentry_value_new_list();
+		const auto *ptr = p_array.ptr();
+		int64_t size = p_array.size();
+		for (int64_t i = 0; i < size; i++) {
+			sentry_value_append(sentry_list, p_convert(ptr[i]));
+		}
+		return sentry_list;
+	}
+
+	template <typename T>
+	static sentry_value_t _stringified_to_list(const T &p_array) {
+		return _packed_to_list(p_array, [](const auto &p_value) { return sentry_value_new_string(Variant(p_value).stringify().utf8()); });
+	}
+
+	sentry_value_t _convert_array(const Variant &p_variant, int p_depth) {
+		// Packed arrays are read directly from their storage, without boxing each element in a Variant.
+		switch (p_variant.get_type()) {
+			case Variant::Type::PACKED_BYTE_ARRAY: {
+				return _packed_to_list(p_variant.operator PackedByteArray(), [](uint8_t p_value) { return sentry_value_new_int64(p_value); });
+			} break;
+			case Variant::Type::PACKED_INT32_ARRAY: {
+				return _packed_to_list(p_variant.operator PackedInt32Array(), [](int32_t p_value) { return sentry_value_new_int64(p_value); });
+			} break;
+			case Variant::Type::PACKED_INT64_ARRAY: {
+				return _packed_to_list(p_variant.operator PackedInt64Array(), [](int64_t p_value) { return sentry_value_new_int64(p_value); });
+			} break;
+			case Variant::Type::PACKED_FLOAT32_ARRAY: {
+				return _packed_to_list(p_variant.operator PackedFloat32Array(), [](float p_value) { return sentry_value_new_double(p_value); });
+			} break;
+			case Variant::Type::PACKED_FLOAT64_ARRAY: {
+				return _packed_to_list(p_variant.operator PackedFloat64Array(), [](double p_value) { return sentry_value_new_double(p_value); });
+			} break;
+			case Variant::Type::PACKED_STRING_ARRAY: {
+				return _packed_to_list(p_variant.operator PackedStringArray(), [](const String &p_value) { return sentry_value_new_string(p_value.utf8()); });
+			} break;
+			case Variant::Type::PACKED_VECTOR2_ARRAY: {
+				return _stringified_to_list(p_variant.operator PackedVector2Array());
+			} break;
+			case Variant::Type::PACKED_VECTOR3_ARRAY: {
+				return _stringified_to_list(p_variant.operator PackedVector3Array());
+			} break;
+			case Variant::Type::PACKED_COLOR_ARRAY: {
+				return _stringified_to_list(p_variant.operator PackedColorArray());
+			} break;
+			case Variant::Type::PACKED_VECTOR4_ARRAY: {
+				return _stringified_to_list(p_variant.operator PackedVector4Array());
+			} break;
+			default: {
+				Array array = p_variant;
+				sentry_value_t sentry_list = sentry_value_new_list();
+				int64_t size = array.size();
+				for (int64_t i = 0; i < size; i++) {
+					sentry_value_append(sentry_list, convert(array[i], p_depth));
 				}
-			} while (!oob);
-			return sentry_list;
-		} break;
-		default: {
-			return sentry_value_new_string(p_variant.stringify().utf8());
-		} break;
+				return sentry_list;
+			} break;
+		}
+	}
+
+public:
+	void set_by_key(sentry_value_t p_object, const Variant &p_key, sentry_value_t p_value) {
+		switch (p_key.get_type()) {
+			case Variant::STRING: {
+				sentry_value_set_by_key(p_object, p_key.operator String().utf8(), p_value);
+			} break;
+			case Variant::STRING_NAME: {
+				StringName name = p_key;
+				const CharString *utf8 = name_keys.getptr(name);
+				if (!utf8) {
+					utf8 = &name_keys.insert(name, String(name).utf8())->value;
+				}
+				sentry_value_set_by_key(p_object, utf8->get_data(), p_value);
+			} break;
+			default: {
+				sentry_value_set_by_key(p_object, p_key.stringify().utf8(), p_value);
+			} break;
+		}
+	}
+
+	void set_from_dictionary(sentry_value_t p_object, const Dictionary &p_dictionary, int p_depth) {
+		// Iterate keys in place instead of copying them with keys().
+		Variant dictionary = p_dictionary;
+		Variant key;
+		bool valid = false;
+		if (!dictionary.iter_init(key, valid) || !valid) {
+			return;
+		}
+		do {
+			set_by_key(p_object, key, convert(p_dictionary[key], p_depth));
+		} while (dictionary.iter_next(key, valid) && valid);
+	}
+
+	sentry_value_t convert(const Variant &p_variant, int p_depth) {
+		switch (p_variant.get_type()) {
+			case Variant::Type::NIL: {
+				return sentry_value_new_null();
+			} break;
+			case Variant::Type::BOOL: {
+				return sentry_value_new_bool((bool)p_variant);
+			} break;
+			case Variant::Type::INT: {
+				return sentry_value_new_int64((int64_t)p_variant);
+			} break;
+			case Variant::Type::FLOAT: {
+				return sentry_value_new_double((double)p_variant);
+			} break;
+			case Variant::Type::STRING: {
+				return sentry_value_new_string(((String)p_variant).utf8());
+			} break;
+			case Variant::Type::DICTIONARY: {
+				if (p_depth > VARIANT_CONVERSION_MAX_DEPTH) {
+					ERR_PRINT_ONCE("Sentry: Maximum Variant conversion depth reached!");
+					return sentry_value_new_string("{...}");
+				}
+				sentry_value_t sentry_dic = sentry_value_new_object();
+				set_from_dictionary(sentry_dic, p_variant, p_depth + 1);
+				return sentry_dic;
+			} break;
+			case Variant::Type::ARRAY:
+			case Variant::Type::PACKED_BYTE_ARRAY:
+			case Variant::Type::PACKED_INT32_ARRAY:
+			case Variant::Type::PACKED_INT64_ARRAY:
+			case Variant::Type::PACKED_FLOAT32_ARRAY:
+			case Variant::Type::PACKED_FLOAT64_ARRAY:
+			case Variant::Type::PACKED_STRING_ARRAY:
+			case Variant::Type::PACKED_VECTOR2_ARRAY:
+			case Variant::Type::PACKED_VECTOR3_ARRAY:
+			case Variant::Type::PACKED_COLOR_ARRAY:
+			case Variant::Type::PACKED_VECTOR4_ARRAY: {
+				if (p_depth > VARIANT_CONVERSION_MAX_DEPTH) {
+					ERR_PRINT_ONCE("Sentry: Maximum Variant conversion depth reached!");
+					return sentry_value_new_string("[...]");
+				}
+				return _convert_array(p_variant, p_depth + 1);
+			} break;
+			default: {
+				return sentry_value_new_string(p_variant.stringify().utf8());
+			} break;
+		}
 	}
+};
+
+} // unnamed namespace
+
+sentry_value_t variant_to_sentry_value(const Variant &p_variant, int p_depth) {
+	VariantConverter converter;
+	return converter.convert(p_variant, p_depth);
+}
+
+void sentry_value_set_from_dictionary(sentry_value_t p_object, const Dictionary &p_values) {
+	VariantConverter converter;
+	converter.set_from_dictionary(p_object, p_values, 0);
 }
 
 sentry_value_t strings_to_sentry_list(const PackedStringArray &p_strings) {
@@ -188,6 +288,32 @@ sentry_value_t dictionary_to_attributes(const Dictionary &p_attributes) {
 	return rv;
 }
 
+sentry_value_t compiled_attributes_to_native(const Ref<SentryAttributes> &p_attributes) {
+	if (p_attributes.is_null() || p_attributes->is_empty()) {
+		return sentry_value_new_null();
+	}
+	sentry_value_t rv = sentry_value_new_object();
+	for (const SentryAttributes::Entry &entry : p_attributes->get_entries()) {
+		sentry_value_t value;
+		switch (entry.type) {
+			case Variant::BOOL: {
+				value = sentry_value_new_bool(entry.bool_value);
+			} break;
+			case Variant::INT: {
+				value = sentry_value_new_int64(entry.int_value);
+			} break;
+			case Variant::FLOAT: {
+				value = sentry_value_new_double(entry.float_value);
+			} break;
+			default: {
+				value = sentry_value_new_string(entry.string_value.get_data());
+			} break;
+		}
+		sentry_value_set_by_key(rv, entry.name.get_data(), sentry_value_new_attribute(value, NULL));
+	}
+	return rv;
+}
+
 Variant sentry_value_get_attribute(sentry_value_t p_value, const String &p_name) {
 	sentry_value_t attributes = sentry_value_get_by_key(p_value, "attributes");
 	if (sentry_value_is_null(attributes)) {
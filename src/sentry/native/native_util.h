@@ -2,6 +2,7 @@
 
 #include "godot_cpp/core/defs.hpp"
 #include "sentry/level.h"
+#include "sentry/sentry_attributes.h"
 #include "sentry/sentry_user.h"
 
 #include <sentry.h>
@@ -16,6 +17,9 @@ namespace sentry::native {
 // Convert Godot Variant to sentry_value_t.
 sentry_value_t variant_to_sentry_value(const Variant &p_variant, int p_depth = 0);
 
+// Set dictionary entries on a sentry_value_t object, converting values with variant_to_sentry_value().
+void sentry_value_set_from_dictionary(sentry_value_t p_object, const Dictionary &p_values);
+
 // Convert PackedStringArray to sentry_value_t (as a list).
 sentry_value_t strings_to_sentry_list(const PackedStringArray &p_strings);
 
@@ -41,6 +45,10 @@ _FORCE_INLINE_ void sentry_value_set_or_remove_string_by_key(sentry_value_t valu
 sentry_value_t variant_to_attribute(const Variant &p_value);
 sentry_value_t dictionary_to_attributes(const Dictionary &p_attributes);
 
+// Builds attributes from entries encoded in advance, without converting Variants.
+// A new object is created for each call, since the SDK takes ownership and adds its own attributes.
+sentry_value_t compiled_attributes_to_native(const Ref<SentryAttributes> &p_attributes);
+
 Variant sentry_value_get_attribute(sentry_value_t p_value, const String &p_name);
 void sentry_value_set_attribute(sentry_value_t p_native, const String &p_name, const Variant &p_value);
 void sentry_value_add_attributes(sentry_value_t p_native, const Dictionary &p_attributes);
@@ -0,0 +1,148 @@
+#include "performance_snapshot.h"
+
+#include "sentry/sentry_sdk.h"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/performance.hpp>
+
+namespace {
+
+inline int64_t _monitor_int(Performance::Monitor p_monitor) {
+	return (int64_t)Performance::get_singleton()->get_monitor(p_monitor);
+}
+
+inline double _monitor_ms(Performance::Monitor p_monitor) {
+	return Performance::get_singleton()->get_monitor(p_monitor) * 1000.0;
+}
+
+} // unnamed namespace
+
+namespace sentry {
+
+void sample_performance(PerformanceSnapshot &r_snapshot) {
+	ERR_FAIL_NULL(OS::get_singleton());
+	ERR_FAIL_NULL(Engine::get_singleton());
+	ERR_FAIL_NULL(Performance::get_singleton());
+
+	r_snapshot.static_memory_usage = OS::get_singleton()->get_static_memory_usage();
+	r_snapshot.static_memory_peak_usage = OS::get_singleton()->get_static_memory_peak_usage();
+
+#ifndef IOS_ENABLED
+	// NOTE: Memory info access on iOS can cause runtime errors in Godot 4.5.
+	// Stack size doesn't change, so it is only queried once.
+	if (r_snapshot.main_thread_stack_size < 0) {
+		Dictionary meminfo = OS::get_singleton()->get_memory_info();
+		r_snapshot.main_thread_stack_size = meminfo.get("stack", -1);
+	}
+#endif // !IOS_ENABLED
+
+	r_snapshot.video_memory_used = _monitor_int(Performance::RENDER_VIDEO_MEM_USED);
+	r_snapshot.texture_memory_used = _monitor_int(Performance::RENDER_TEXTURE_MEM_USED);
+	r_snapshot.buffer_memory_used = _monitor_int(Performance::RENDER_BUFFER_MEM_USED);
+
+	r_snapshot.fps = Engine::get_singleton()->get_frames_per_second();
+	r_snapshot.frames_drawn = Engine::get_singleton()->get_frames_drawn();
+	r_snapshot.process_time_ms = _monitor_ms(Performance::TIME_PROCESS);
+	r_snapshot.physics_process_time_ms = _monitor_ms(Performance::TIME_PHYSICS_PROCESS);
+	r_snapshot.navigation_process_time_ms = _monitor_ms(Performance::TIME_NAVIGATION_PROCESS);
+
+	r_snapshot.draw_calls = _monitor_int(Performance::RENDER_TOTAL_DRAW_CALLS_IN_FRAME);
+	r_snapshot.objects_in_frame = _monitor_int(Performance::RENDER_TOTAL_OBJECTS_IN_FRAME);
+	r_snapshot.primitives_in_frame = _monitor_int(Performance::RENDER_TOTAL_PRIMITIVES_IN_FRAME);
+
+	r_snapshot.object_count = _monitor_int(Performance::OBJECT_COUNT);
+	r_snapshot.node_count = _monitor_int(Performance::OBJECT_NODE_COUNT);
+	r_snapshot.orphan_node_count = _monitor_int(Performance::OBJECT_ORPHAN_NODE_COUNT);
+	r_snapshot.resource_count = _monitor_int(Performance::OBJECT_RESOURCE_COUNT);
+
+	r_snapshot.physics_2d_active_objects = _monitor_int(Performance::PHYSICS_2D_ACTIVE_OBJECTS);
+	r_snapshot.physics_2d_collision_pairs = _monitor_int(Performance::PHYSICS_2D_COLLISION_PAIRS);
+	r_snapshot.physics_2d_island_count = _monitor_int(Performance::PHYSICS_2D_ISLAND_COUNT);
+	r_snapshot.physics_3d_active_objects = _monitor_int(Performance::PHYSICS_3D_ACTIVE_OBJECTS);
+	r_snapshot.physics_3d_collision_pairs = _monitor_int(Performance::PHYSICS_3D_COLLISION_PAIRS);
+	r_snapshot.physics_3d_island_count = _monitor_int(Performance::PHYSICS_3D_ISLAND_COUNT);
+
+	r_snapshot.navigation_active_maps = _monitor_int(Performance::NAVIGATION_ACTIVE_MAPS);
+	r_snapshot.navigation_region_count = _monitor_int(Performance::NAVIGATION_REGION_COUNT);
+	r_snapshot.navigation_agent_count = _monitor_int(Performance::NAVIGATION_AGENT_COUNT);
+
+	r_snapshot.audio_output_latency_ms = _monitor_ms(Performance::AUDIO_OUTPUT_LATENCY);
+
+	r_snapshot.sampled = true;
+}
+
+Dictionary performance_snapshot_to_context(const PerformanceSnapshot &p_snapshot) {
+	Dictionary context;
+
+	if (p_snapshot.static_memory_usage >= 0) {
+		context["static_memory_usage"] = p_snapshot.static_memory_usage;
+		context["static_memory_peak_usage"] = p_snapshot.static_memory_peak_usage;
+	}
+	if (p_snapshot.main_thread_stack_size >= 0) {
+		context["main_thread_stack_size"] = p_snapshot.main_thread_stack_size;
+	}
+	context["rendering_video_mem_used"] = p_snapshot.video_memory_used;
+	context["rendering_texture_mem_used"] = p_snapshot.texture_memory_used;
+	context["rendering_buffer_mem_used"] = p_snapshot.buffer_memory_used;
+
+	if (p_snapshot.fps) {
+		context["fps"] = p_snapshot.fps;
+	}
+	context["frames_drawn"] = p_snapshot.frames_drawn;
+	context["process_time_ms"] = p_snapshot.process_time_ms;
+	context["physics_process_time_ms"] = p_snapshot.physics_process_time_ms;
+	context["navigation_process_time_ms"] = p_snapshot.navigation_process_time_ms;
+	if (p_snapshot.frame_time_p50_ms > 0.0) {
+		context["frame_time_p50_ms"] = p_snapshot.frame_time_p50_ms;
+		context["frame_time_p95_ms"] = p_snapshot.frame_time_p95_ms;
+		context["frame_time_p99_ms"] = p_snapshot.frame_time_p99_ms;
+	}
+	context["frame_hitch_count"] = p_snapshot.frame_hitch_count;
+	context["frame_severe_hitch_count"] = p_snapshot.frame_severe_hitch_count;
+
+	context["rendering_draw_calls"] = p_snapshot.draw_calls;
+	context["rendering_objects_in_frame"] = p_snapshot.objects_in_frame;
+	context["rendering_primitives_in_frame"] = p_snapshot.primitives_in_frame;
+
+	context["object_count"] = p_snapshot.object_count;
+	context["object_node_count"] = p_snapshot.node_count;
+	context["object_orphan_node_count"] = p_snapshot.orphan_node_count;
+	context["object_resource_count"] = p_snapshot.resource_count;
+
+	context["physics_2d_active_objects"] = p_snapshot.physics_2d_active_objects;
+	context["physics_2d_collision_pairs"] = p_snapshot.physics_2d_collision_pairs;
+	context["physics_2d_island_count"] = p_snapshot.physics_2d_island_count;
+	context["physics_3d_active_objects"] = p_snapshot.physics_3d_active_objects;
+	context["physics_3d_collision_pairs"] = p_snapshot.physics_3d_collision_pairs;
+	context["physics_3d_island_count"] = p_snapshot.physics_3d_island_count;
+
+	context["navigation_active_maps"] = p_snapshot.navigation_active_maps;
+	context["navigation_region_count"] = p_snapshot.navigation_region_count;
+	context["navigation_agent_count"] = p_snapshot.navigation_agent_count;
+
+	context["audio_output_latency_ms"] = p_snapshot.audio_output_latency_ms;
+
+	return context;
+}
+
+void emit_performance_metrics(const PerformanceSnapshot &p_snapshot) {
+	SentryMetrics *metrics = SentrySDK::get_singleton()->get_metrics();
+	ERR_FAIL_NULL(metrics);
+
+	if (p_snapshot.static_memory_usage >= 0) {
+		metrics->gauge("godot.memory.static", p_snapshot.static_memory_usage, "byte");
+	}
+	metrics->gauge("godot.memory.video", p_snapshot.video_memory_used, "byte");
+	metrics->gauge("godot.fps", p_snapshot.fps);
+	metrics->gauge("godot.rendering.draw_calls", p_snapshot.draw_calls);
+	metrics->gauge("godot.objects", p_snapshot.object_count);
+	metrics->gauge("godot.nodes", p_snapshot.node_count);
+	metrics->gauge("godot.nodes.orphan", p_snapshot.orphan_node_count);
+	metrics->gauge("godot.physics_2d.active_objects", p_snapshot.physics_2d_active_objects);
+	metrics->gauge("godot.physics_3d.active_objects", p_snapshot.physics_3d_active_objects);
+	metrics->gauge("godot.navigation.agents", p_snapshot.navigation_agent_count);
+	metrics->gauge("godot.audio.output_latency", p_snapshot.audio_output_latency_ms, "millisecond");
+}
+
+} //namespace sentry
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <godot_cpp/variant/dictionary.hpp>
+
+using namespace godot;
+
+namespace sentry {
+
+// Numeric snapshot of engine performance monitors.
+// Sampled in place, so that refreshing it doesn't allocate.
+struct PerformanceSnapshot {
+	bool sampled = false;
+
+	// Memory in bytes; -1 if unavailable on the platform.
+	int64_t static_memory_usage = -1;
+	int64_t static_memory_peak_usage = -1;
+	int64_t main_thread_stack_size = -1;
+	int64_t video_memory_used = -1;
+	int64_t texture_memory_used = -1;
+	int64_t buffer_memory_used = -1;
+
+	// Frame timing. Percentiles are over recent frames; 0 if not enough frames were recorded.
+	// Hitch counts are totals since the start of the session.
+	double fps = 0.0;
+	int64_t frames_drawn = 0;
+	double process_time_ms = 0.0;
+	double physics_process_time_ms = 0.0;
+	double navigation_process_time_ms = 0.0;
+	double frame_time_p50_ms = 0.0;
+	double frame_time_p95_ms = 0.0;
+	double frame_time_p99_ms = 0.0;
+	int64_t frame_hitch_count = 0;
+	int64_t frame_severe_hitch_count = 0;
+
+	// Rendering, in the last frame.
+	int64_t draw_calls = 0;
+	int64_t objects_in_frame = 0;
+	int64_t primitives_in_frame = 0;
+
+	// Objects.
+	int64_t object_count = 0;
+	int64_t node_count = 0;
+	int64_t orphan_node_count = 0;
+	int64_t resource_count = 0;
+
+	// Physics.
+	int64_t physics_2d_active_objects = 0;
+	int64_t physics_2d_collision_pairs = 0;
+	int64_t physics_2d_island_count = 0;
+	int64_t physics_3d_active_objects = 0;
+	int64_t physics_3d_collision_pairs = 0;
+	int64_t physics_3d_island_count = 0;
+
+	// Navigation.
+	int64_t navigation_active_maps = 0;
+	int64_t navigation_region_count = 0;
+	int64_t navigation_agent_count = 0;
+
+	// Audio.
+	double audio_output_latency_ms = 0.0;
+};
+
+// Reads engine performance monitors into the snapshot. Main thread only.
+void sample_performance(PerformanceSnapshot &r_snapshot);
+
+// Creates the "godot_performance" event context.
+Dictionary performance_snapshot_to_context(const PerformanceSnapshot &p_snapshot);
+
+// Records snapshot values as metrics (gauges).
+void emit_performance_metrics(const PerformanceSnapshot &p_snapshot);
+
+} //namespace sentry
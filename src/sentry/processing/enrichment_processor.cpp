@@ -1,6 +1,13 @@
 #include "enrichment_processor.h"
 
 #include "sentry/contexts.h"
+#include "sentry/engine_lifecycle/engine_lifecycle.h"
+#include "sentry/sentry_sdk.h"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
 
 namespace sentry {
 
@@ -15,7 +22,31 @@ Ref<SentryEvent> EnrichmentProcessor::process_event(const Ref<SentryEvent> &p_ev
 #else
 	constexpr bool enrich_crashes = true;
 #endif
-	if (enrich_crashes || !event->is_crash()) {
+	if ((enrich_crashes || !event->is_crash()) && sentry::engine_lifecycle::are_engine_singletons_ready()) {
+		Dictionary performance_context;
+		{
+			std::lock_guard lock{ snapshot_mutex };
+			performance_context = snapshot_context;
+		}
+		if (performance_context.is_empty() && OS::get_singleton()->get_thread_caller_id() == OS::get_singleton()->get_main_thread_id()) {
+			// No frames processed yet.
+			PerformanceSnapshot performance;
+			sample_performance(performance);
+			performance_context = performance_snapshot_to_context(performance);
+		}
+		if (!performance_context.is_empty()) {
+			event->merge_context("godot_performance", performance_context);
+		}
+
+		// Values that change every frame and are cheap to read on any thread, also before the first sample.
+		Dictionary frame_context;
+		double fps = Engine::get_singleton()->get_frames_per_second();
+		if (fps) {
+			frame_context["fps"] = fps;
+		}
+		frame_context["frames_drawn"] = Engine::get_singleton()->get_frames_drawn();
+		event->merge_context("godot_performance", frame_context);
+
 		HashMap<String, Dictionary> contexts = sentry::contexts::make_event_contexts();
 		for (const auto &kv : contexts) {
 			event->merge_context(kv.key, kv.value);
@@ -32,4 +63,76 @@ Ref<SentryEvent> EnrichmentProcessor::process_event(const Ref<SentryEvent> &p_ev
 	return event;
 }
 
+void EnrichmentProcessor::_connect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to start performance sampling - SceneTree is unavailable.");
+
+	Callable callable = callable_mp(this, &EnrichmentProcessor::_process_frame);
+	if (!scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->connect("process_frame", callable);
+	}
+}
+
+void EnrichmentProcessor::_disconnect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Callable callable = callable_mp(this, &EnrichmentProcessor::_process_frame);
+	if (scene_tree && scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->disconnect("process_frame", callable);
+	}
+}
+
+void EnrichmentProcessor::_process_frame() {
+	uint64_t now_usec = Time::get_singleton()->get_ticks_usec();
+	frame_timing.record_frame(now_usec);
+
+	if (now_usec - last_sample_usec < PERFORMANCE_SAMPLE_INTERVAL_USEC) {
+		return;
+	}
+	last_sample_usec = now_usec;
+
+	sample_performance(sampling_snapshot);
+	frame_timing.fill_snapshot(sampling_snapshot);
+	Dictionary context = performance_snapshot_to_context(sampling_snapshot);
+	{
+		std::lock_guard lock{ snapshot_mutex };
+		snapshot_context = context;
+	}
+
+	// Keeps system queries for event contexts off the event path.
+	sentry::contexts::refresh_event_contexts();
+
+	if (last_interval_usec == 0) {
+		last_interval_usec = now_usec;
+	} else if (now_usec - last_interval_usec >= PERFORMANCE_METRICS_INTERVAL_USEC) {
+		last_interval_usec = now_usec;
+		if (performance_metrics) {
+			emit_performance_metrics(sampling_snapshot);
+			frame_timing.emit_metrics();
+		}
+		frame_timing.start_interval();
+	}
+}
+
+void EnrichmentProcessor::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_POSTINITIALIZE: {
+			if (sentry::engine_lifecycle::are_engine_singletons_ready() &&
+					Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+				_connect_process_frame();
+			} else {
+				// Defer signal connection since SceneTree is not available during early initialization.
+				callable_mp(this, &EnrichmentProcessor::_connect_process_frame).call_deferred();
+			}
+		} break;
+		case NOTIFICATION_PREDELETE: {
+			_disconnect_process_frame();
+		} break;
+	}
+}
+
+EnrichmentProcessor::EnrichmentProcessor() {
+	performance_metrics = SENTRY_OPTIONS()->is_performance_metrics_enabled();
+	frame_timing.set_hitch_thresholds(SENTRY_OPTIONS()->get_frame_hitch_threshold_ms(), SENTRY_OPTIONS()->get_frame_severe_hitch_threshold_ms());
+}
+
 } // namespace sentry
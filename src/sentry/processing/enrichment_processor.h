@@ -1,18 +1,47 @@
 #pragma once
 
+#include "sentry/frame_timing_monitor.h"
+#include "sentry/performance_snapshot.h"
 #include "sentry/processing/sentry_event_processor.h"
 
+#include <mutex>
+
 namespace sentry {
 
 // Event processor that injects Godot-specific contexts, such as engine and performance info.
 class EnrichmentProcessor : public SentryEventProcessor {
 	GDCLASS(EnrichmentProcessor, SentryEventProcessor);
 
+private:
+	// Performance monitors are sampled on the main thread at this interval, and shared by events in between.
+	static constexpr uint64_t PERFORMANCE_SAMPLE_INTERVAL_USEC = 500'000;
+	// Frame time percentiles are computed over this interval, and reported as metrics if enabled.
+	static constexpr uint64_t PERFORMANCE_METRICS_INTERVAL_USEC = 10'000'000;
+
+	// Context built from the latest sample, shared by events without copying. Replaced rather than modified,
+	// so events can read it outside of the lock. Empty until the first sample. Guarded by snapshot_mutex.
+	std::mutex snapshot_mutex;
+	Dictionary snapshot_context;
+
+	// Main thread only.
+	PerformanceSnapshot sampling_snapshot;
+	FrameTimingMonitor frame_timing;
+	uint64_t last_sample_usec = 0;
+	uint64_t last_interval_usec = 0;
+	bool performance_metrics = false;
+
+	void _connect_process_frame();
+	void _disconnect_process_frame();
+	void _process_frame();
+
 protected:
 	static void _bind_methods() {}
+	void _notification(int p_what);
 
 public:
 	virtual Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) override;
+
+	EnrichmentProcessor();
 };
 
 } // namespace sentry
@@ -29,8 +29,22 @@ Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) {
 		return nullptr;
 	}
 
+	// Batched logs that led up to this event are sent first.
+	if (SentryLogger *logger = SentrySDK::get_singleton()->get_logger()) {
+		logger->flush_before_event(p_event->is_crash());
+	}
+
 	sentry::logging::print_debug("Processing event ", p_event->get_id());
 
+	// Let background attachment work overlap with the rest of processing, and finish it on return.
+	struct AttachmentsFinisher {
+		~AttachmentsFinisher() {
+			for (const Ref<SentryEventProcessor> &processor : SENTRY_OPTIONS()->get_event_processors()) {
+				processor->finish_attachments();
+			}
+		}
+	} attachments_finisher;
+
 	Ref<SentryEvent> event = p_event;
 
 	// Event processors
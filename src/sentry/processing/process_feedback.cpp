@@ -23,6 +23,15 @@ Ref<SentryEvent> process_feedback(const Ref<SentryEvent> &p_event) {
 
 	sentry::logging::print_debug("Processing feedback ", p_event->get_id());
 
+	// Let background attachment work overlap with the rest of processing, and finish it on return.
+	struct AttachmentsFinisher {
+		~AttachmentsFinisher() {
+			for (const Ref<SentryEventProcessor> &processor : SENTRY_OPTIONS()->get_event_processors()) {
+				processor->finish_attachments();
+			}
+		}
+	} attachments_finisher;
+
 	Ref<SentryEvent> event = p_event;
 
 	for (const Ref<SentryEventProcessor> &processor : SENTRY_OPTIONS()->get_event_processors()) {
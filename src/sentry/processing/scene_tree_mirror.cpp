@@ -0,0 +1,162 @@
+#include "scene_tree_mirror.h"
+
+#include <godot_cpp/classes/script.hpp>
+
+namespace sentry {
+
+int SceneTreeMirror::_get_regular_index(Node *p_node) {
+	Node *parent = p_node->get_parent();
+	if (!parent) {
+		return -1;
+	}
+
+	// Internal children are placed before (front) and after (back) the regular ones.
+	int regular_count = parent->get_child_count(false);
+	if (regular_count == 0) {
+		return -1;
+	}
+	int front_count = parent->get_child(0, false)->get_index(true);
+	int index = p_node->get_index(true) - front_count;
+	return (index >= 0 && index < regular_count) ? index : -1;
+}
+
+SceneTreeMirror::Entry &SceneTreeMirror::_insert(Node *p_node, uint64_t p_parent_id) {
+	Entry &entry = entries[p_node->get_instance_id()];
+	entry.name = p_node->get_name();
+	entry.class_name = p_node->get_class();
+	entry.scene_path = p_node->get_scene_file_path();
+	Ref<Script> script = p_node->get_script();
+	entry.script_path = script.is_valid() ? script->get_path() : String();
+	entry.parent = p_parent_id;
+	entry.children.clear();
+	return entry;
+}
+
+void SceneTreeMirror::_erase_subtree(uint64_t p_id) {
+	auto it = entries.find(p_id);
+	if (it == entries.end()) {
+		return;
+	}
+	// Children are normally removed before their parent, so this is rarely non-empty.
+	std::vector<uint64_t> children = std::move(it->second.children);
+	for (uint64_t child : children) {
+		_erase_subtree(child);
+	}
+	entries.erase(p_id);
+}
+
+void SceneTreeMirror::_remove(uint64_t p_id) {
+	auto it = entries.find(p_id);
+	if (it == entries.end()) {
+		return;
+	}
+
+	auto parent_it = entries.find(it->second.parent);
+	if (parent_it != entries.end()) {
+		// Children leave the tree in reverse order, so search from the back.
+		std::vector<uint64_t> &siblings = parent_it->second.children;
+		for (size_t i = siblings.size(); i > 0; i--) {
+			if (siblings[i - 1] == p_id) {
+				siblings.erase(siblings.begin() + (i - 1));
+				break;
+			}
+		}
+	}
+
+	_erase_subtree(p_id);
+
+	if (p_id == root_id) {
+		root_id = 0;
+	}
+}
+
+void SceneTreeMirror::reset(Node *p_root) {
+	std::lock_guard guard{ mutex };
+
+	entries.clear();
+	root_id = 0;
+	if (!p_root) {
+		return;
+	}
+
+	root_id = p_root->get_instance_id();
+	_insert(p_root, 0);
+
+	std::vector<Node *> stack{ p_root };
+	while (!stack.empty()) {
+		Node *node = stack.back();
+		stack.pop_back();
+
+		// References to unordered_map elements stay valid when inserting children.
+		uint64_t node_id = node->get_instance_id();
+		Entry &entry = entries[node_id];
+		int child_count = node->get_child_count();
+		entry.children.reserve(child_count);
+		for (int i = 0; i < child_count; i++) {
+			Node *child = node->get_child(i);
+			entry.children.push_back(child->get_instance_id());
+			_insert(child, node_id);
+			stack.push_back(child);
+		}
+	}
+}
+
+void SceneTreeMirror::clear() {
+	std::lock_guard guard{ mutex };
+	entries.clear();
+	root_id = 0;
+}
+
+void SceneTreeMirror::add_node(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+
+	Node *parent = p_node->get_parent();
+	if (!parent) {
+		return;
+	}
+
+	std::lock_guard guard{ mutex };
+
+	// Skip nodes under internal or otherwise untracked parents.
+	uint64_t parent_id = parent->get_instance_id();
+	if (entries.find(parent_id) == entries.end()) {
+		return;
+	}
+
+	int index = _get_regular_index(p_node);
+	if (index < 0) {
+		return;
+	}
+
+	uint64_t id = p_node->get_instance_id();
+	if (entries.find(id) != entries.end()) {
+		// Shouldn't happen, but keep the mirror consistent: detach from the old parent as well.
+		_remove(id);
+	}
+
+	_insert(p_node, parent_id);
+
+	std::vector<uint64_t> &siblings = entries[parent_id].children;
+	siblings.insert(siblings.begin() + MIN(size_t(index), siblings.size()), id);
+}
+
+void SceneTreeMirror::remove_node(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+
+	std::lock_guard guard{ mutex };
+
+	_remove(p_node->get_instance_id());
+}
+
+void SceneTreeMirror::rename_node(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+
+	std::lock_guard guard{ mutex };
+
+	auto it = entries.find(p_node->get_instance_id());
+	if (it != entries.end()) {
+		it->second.name = p_node->get_name();
+	}
+}
+
+} //namespace sentry
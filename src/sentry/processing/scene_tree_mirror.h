@@ -0,0 +1,62 @@
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+namespace sentry {
+
+// Compact copy of the scene tree, kept up to date from SceneTree's node_added, node_removed
+// and node_renamed signals, so the view hierarchy can be serialized without walking the live tree.
+// Only regular (non-internal) children are mirrored, same as in the live tree capture.
+// Limitations: reordering children with move_child() and changing a node's script while it
+// is inside the tree are not reflected until the node re-enters the tree.
+// Updated on the main thread, can be read from any thread while holding the lock.
+class SceneTreeMirror {
+public:
+	struct Entry {
+		String name;
+		String class_name;
+		String scene_path;
+		String script_path;
+		uint64_t parent = 0;
+		std::vector<uint64_t> children;
+	};
+
+private:
+	mutable std::mutex mutex;
+	std::unordered_map<uint64_t, Entry> entries;
+	uint64_t root_id = 0;
+
+	static int _get_regular_index(Node *p_node);
+	Entry &_insert(Node *p_node, uint64_t p_parent_id);
+	void _erase_subtree(uint64_t p_id);
+	// Erases the subtree and detaches it from its parent's children.
+	void _remove(uint64_t p_id);
+
+public:
+	// Rebuilds the mirror from the live tree. Main thread only.
+	void reset(Node *p_root);
+	void clear();
+
+	// Signal handlers. Main thread only.
+	void add_node(Node *p_node);
+	void remove_node(Node *p_node);
+	void rename_node(Node *p_node);
+
+	// Lock must be held while accessing entries.
+	std::unique_lock<std::mutex> lock() const { return std::unique_lock<std::mutex>(mutex); }
+
+	const Entry *get_root() const { return get_entry(root_id); }
+	const Entry *get_entry(uint64_t p_id) const {
+		auto it = entries.find(p_id);
+		return it != entries.end() ? &it->second : nullptr;
+	}
+	size_t size() const { return entries.size(); }
+};
+
+} //namespace sentry
@@ -4,13 +4,16 @@
 #include "sentry/engine_lifecycle/engine_lifecycle.h"
 #include "sentry/logging/print.h"
 #include "sentry/sentry_sdk.h"
-#include "sentry/util/screenshot.h" // TODO: incorporate
 
 #include <godot_cpp/classes/dir_access.hpp>
 #include <godot_cpp/classes/display_server.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/viewport_texture.hpp>
+#include <godot_cpp/classes/window.hpp>
 
 namespace sentry {
 
@@ -30,8 +33,13 @@ Ref<SentryEvent> ScreenshotProcessor::process_event(const Ref<SentryEvent> &p_ev
 			return p_event;
 		}
 
-		// Remove the outdated screenshot.
-		DirAccess::remove_absolute(screenshot_path);
+		// Remove the outdated screenshot. One still being encoded belongs to a concurrent event, so it's recent.
+		if (!encoder_busy) {
+			DirAccess::remove_absolute(screenshot_path);
+			if (history_enabled) {
+				DirAccess::remove_absolute(history_path);
+			}
+		}
 	}
 
 	if (OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id()) {
@@ -79,22 +87,241 @@ Ref<SentryEvent> ScreenshotProcessor::process_event(const Ref<SentryEvent> &p_ev
 	mutex.unlock();
 
 	sentry::logging::print_debug("Taking screenshot");
-	PackedByteArray buffer = sentry::util::take_screenshot();
+	Ref<Image> image = sentry::util::capture_screenshot();
+	if (image.is_null()) {
+		return p_event;
+	}
+
+	Ref<Image> history_sheet = history_enabled ? history.make_contact_sheet() : Ref<Image>();
+
+	_wait_for_encoder();
+	{
+		std::lock_guard lock{ mutex };
+		if (!encoder.joinable()) {
+			encoder = std::thread(&ScreenshotProcessor::_encoder_loop, this);
+		}
+		pending_image = image;
+		pending_history = history_sheet;
+		encoder_busy = true;
+	}
+	encoder_cv.notify_all();
+
+	return p_event;
+}
+
+void ScreenshotProcessor::_encoder_loop() {
+	std::unique_lock lock{ mutex };
+	while (true) {
+		encoder_cv.wait(lock, [this] { return encoder_exit || pending_image.is_valid(); });
+		if (pending_image.is_null()) {
+			return; // exit requested, nothing left to encode
+		}
+
+		Ref<Image> image = pending_image;
+		Ref<Image> history_sheet = pending_history;
+		pending_image.unref();
+		pending_history.unref();
+
+		lock.unlock();
+		_encode_and_save(image, history_sheet, settings, screenshot_path, history_path);
+		image.unref();
+		history_sheet.unref();
+		lock.lock();
+
+		encoder_busy = false;
+		encoder_cv.notify_all();
+	}
+}
 
-	Ref<FileAccess> f = FileAccess::open(screenshot_path, FileAccess::WRITE);
+void ScreenshotProcessor::_stop_encoder() {
+	{
+		std::lock_guard lock{ mutex };
+		if (!encoder.joinable()) {
+			return;
+		}
+		encoder_exit = true;
+	}
+	encoder_cv.notify_all();
+
+	if (encoder.get_id() == std::this_thread::get_id()) {
+		encoder.detach();
+	} else {
+		encoder.join();
+	}
+}
+
+void ScreenshotProcessor::_wait_for_encoder() {
+	std::unique_lock lock{ mutex };
+	// Errors logged while encoding produce events that are processed on the encoder thread itself.
+	if (encoder.get_id() == std::this_thread::get_id()) {
+		return;
+	}
+	encoder_cv.wait(lock, [this] { return !encoder_busy; });
+}
+
+void ScreenshotProcessor::_encode_and_save(Ref<Image> p_image, Ref<Image> p_history, sentry::util::ScreenshotSettings p_settings, String p_path, String p_history_path) {
+	_save_buffer(sentry::util::encode_screenshot(p_image, p_settings), p_path);
+
+	if (p_history.is_valid()) {
+		// History frames are already downscaled.
+		sentry::util::ScreenshotSettings history_settings;
+		history_settings.quality = p_settings.quality;
+		_save_buffer(sentry::util::encode_screenshot(p_history, history_settings), p_history_path);
+	}
+}
+
+void ScreenshotProcessor::_save_buffer(const PackedByteArray &p_buffer, const String &p_path) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
 	if (f.is_valid()) {
-		f->store_buffer(buffer);
+		f->store_buffer(p_buffer);
 		f->flush();
 		f->close();
 	} else {
-		sentry::logging::print_error("Failed to save ", screenshot_path);
+		sentry::logging::print_error("Failed to save ", p_path);
 	}
+}
 
-	return p_event;
+void ScreenshotProcessor::_connect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to start frame history capture - SceneTree is unavailable.");
+
+	if (DisplayServer::get_singleton()->get_name() == "headless") {
+		sentry::logging::print_debug("Skipping frame history capture - headless mode");
+		return;
+	}
+
+	_create_history_viewport();
+
+	Callable callable = callable_mp(this, &ScreenshotProcessor::_process_frame);
+	if (!scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->connect("process_frame", callable);
+	}
+}
+
+void ScreenshotProcessor::_disconnect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Callable callable = callable_mp(this, &ScreenshotProcessor::_process_frame);
+	if (scene_tree && scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->disconnect("process_frame", callable);
+	}
+
+	_free_history_viewport();
+}
+
+void ScreenshotProcessor::_process_frame() {
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+
+	// The frame requested last frame has been rendered by now. Reading it back still waits for the GPU,
+	// but only transfers a frame-sized image, which goes into the preallocated history as is.
+	if (history_frame_requested && frame % history_interval == 0) {
+		history_frame_requested = false;
+		RenderingServer *rs = RenderingServer::get_singleton();
+		Ref<Image> image = rs->texture_2d_get(rs->viewport_get_texture(history_viewport));
+		if (image.is_valid() && !image->is_empty()) {
+			history.push(image);
+		}
+	}
+
+	if ((frame + 1) % history_interval == 0) {
+		_request_history_frame();
+	}
+}
+
+void ScreenshotProcessor::_create_history_viewport() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	history_viewport = rs->viewport_create();
+	rs->viewport_set_disable_3d(history_viewport, true);
+	rs->viewport_set_update_mode(history_viewport, RenderingServer::VIEWPORT_UPDATE_DISABLED);
+	history_canvas = rs->canvas_create();
+	rs->viewport_attach_canvas(history_viewport, history_canvas);
+	history_canvas_item = rs->canvas_item_create();
+	rs->canvas_item_set_parent(history_canvas_item, history_canvas);
+	rs->viewport_set_active(history_viewport, true);
+}
+
+void ScreenshotProcessor::_free_history_viewport() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	if (!rs || !history_viewport.is_valid()) {
+		return;
+	}
+	rs->free_rid(history_canvas_item);
+	rs->free_rid(history_canvas);
+	rs->free_rid(history_viewport);
+	history_canvas_item = RID();
+	history_canvas = RID();
+	history_viewport = RID();
+}
+
+void ScreenshotProcessor::_request_history_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Window *root = scene_tree ? scene_tree->get_root() : nullptr;
+	if (!root || !history_viewport.is_valid()) {
+		return;
+	}
+
+	Ref<ViewportTexture> source = root->get_texture();
+	Vector2i source_size{ source->get_width(), source->get_height() };
+	if (source_size.x <= 0 || source_size.y <= 0) {
+		return;
+	}
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	if (source_size != history_source_size) {
+		history_source_size = source_size;
+		Vector2i frame_size = history.get_frame_size_for(source_size.x, source_size.y);
+		rs->viewport_set_size(history_viewport, frame_size.x, frame_size.y);
+		rs->canvas_item_clear(history_canvas_item);
+		rs->canvas_item_add_texture_rect(history_canvas_item, Rect2(Vector2(), Vector2(frame_size)), source->get_rid());
+	}
+
+	// Drawn once, when the engine renders this frame.
+	rs->viewport_set_update_mode(history_viewport, RenderingServer::VIEWPORT_UPDATE_ONCE);
+	history_frame_requested = true;
+}
+
+void ScreenshotProcessor::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_POSTINITIALIZE: {
+			if (!history_enabled) {
+				return;
+			}
+			if (sentry::engine_lifecycle::are_engine_singletons_ready() &&
+					Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+				_connect_process_frame();
+			} else {
+				// Defer signal connection since SceneTree is not available during early initialization.
+				callable_mp(this, &ScreenshotProcessor::_connect_process_frame).call_deferred();
+			}
+		} break;
+		case NOTIFICATION_PREDELETE: {
+			if (history_enabled) {
+				_disconnect_process_frame();
+			}
+		} break;
+	}
+}
+
+void ScreenshotProcessor::finish_attachments() {
+	_wait_for_encoder();
 }
 
 ScreenshotProcessor::ScreenshotProcessor() {
-	screenshot_path = "user://" SENTRY_SCREENSHOT_FN;
+	settings.format = SENTRY_OPTIONS()->get_screenshot_format();
+	settings.quality = SENTRY_OPTIONS()->get_screenshot_quality();
+	settings.max_size = SENTRY_OPTIONS()->get_screenshot_max_size();
+	screenshot_path = String("user://") + sentry::util::get_screenshot_file_name(settings.format);
+
+	int history_frames = SENTRY_OPTIONS()->get_screenshot_history_frames();
+	history_enabled = history_frames > 0;
+	if (history_enabled) {
+		history_path = "user://" SENTRY_FRAME_HISTORY_FN;
+		history_interval = SENTRY_OPTIONS()->get_screenshot_history_interval();
+		history.init(history_frames, SENTRY_OPTIONS()->get_screenshot_history_frame_size());
+	}
+}
+
+ScreenshotProcessor::~ScreenshotProcessor() {
+	_stop_encoder();
 }
 
 } // namespace sentry
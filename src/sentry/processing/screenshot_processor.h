@@ -1,28 +1,75 @@
 #pragma once
 
 #include "sentry/processing/sentry_event_processor.h"
+#include "sentry/util/frame_ring_buffer.h"
+#include "sentry/util/screenshot.h"
 
+#include <condition_variable>
+#include <godot_cpp/classes/image.hpp>
 #include <mutex>
+#include <thread>
 
 namespace sentry {
 
 // Event processor for capturing in-engine screenshots.
+// Optionally keeps a history of recent frames, attached as a single contact sheet image.
 class ScreenshotProcessor : public SentryEventProcessor {
 	GDCLASS(ScreenshotProcessor, SentryEventProcessor);
 
 private:
 	String screenshot_path;
+	sentry::util::ScreenshotSettings settings;
 	int32_t last_screenshot_frame = -1;
 	std::mutex mutex;
 
+	// Frame history: every history_interval frames, a downscaled frame is stored. Main thread only.
+	bool history_enabled = false;
+	int history_interval = 10;
+	String history_path;
+	sentry::util::FrameRingBuffer history;
+
+	// The root viewport is drawn into this frame-sized viewport on the GPU, so only small images are read back.
+	RID history_viewport;
+	RID history_canvas;
+	RID history_canvas_item;
+	Vector2i history_source_size;
+	bool history_frame_requested = false;
+
+	// Persistent worker that encodes and writes the last captured screenshot, so only the readback
+	// happens in process_event(). Started with the first screenshot. Guarded by mutex.
+	std::thread encoder;
+	std::condition_variable encoder_cv;
+	Ref<Image> pending_image;
+	Ref<Image> pending_history;
+	bool encoder_busy = false; // job pending or being encoded
+	bool encoder_exit = false;
+
+	void _encoder_loop();
+	void _stop_encoder();
+	// Mutex must not be held, since events can be captured on the encoder thread.
+	void _wait_for_encoder();
+	static void _encode_and_save(Ref<Image> p_image, Ref<Image> p_history, sentry::util::ScreenshotSettings p_settings, String p_path, String p_history_path);
+	static void _save_buffer(const PackedByteArray &p_buffer, const String &p_path);
+
+	void _connect_process_frame();
+	void _disconnect_process_frame();
+	void _process_frame();
+
+	void _create_history_viewport();
+	void _free_history_viewport();
+	void _request_history_frame();
+
 protected:
 	static void _bind_methods() {}
+	void _notification(int p_what);
 
 public:
 	virtual Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) override;
 	virtual bool produces_default_attachment() const override { return true; }
+	virtual void finish_attachments() override;
 
 	ScreenshotProcessor();
+	~ScreenshotProcessor();
 };
 
 } // namespace sentry
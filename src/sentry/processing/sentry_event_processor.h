@@ -23,6 +23,10 @@ public:
 	// Returns true if processing an event also produces one of the SDK's attachments.
 	virtual bool produces_default_attachment() const { return false; }
 
+	// Waits for attachments still being produced in the background after process_event().
+	// Called before the event is sent, since attachment files are read at that point.
+	virtual void finish_attachments() {}
+
 	virtual ~SentryEventProcessor() = default;
 };
 
@@ -1,6 +1,8 @@
 #include "view_hierarchy_builder.h"
 
 #include "sentry/engine_lifecycle/engine_lifecycle.h"
+#include "sentry/util/json_writer.h"
+
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/json.hpp>
 #include <godot_cpp/classes/node.hpp>
@@ -10,93 +12,257 @@
 #include <godot_cpp/variant/string.hpp>
 
 using namespace godot;
+using sentry::util::JSONWriter;
 
 namespace {
 
-inline void _start_name_value_pair_new(sentry::util::UTF8Buffer &p_builder, const char *p_name, const String &p_value) {
-	p_builder.append("\"");
-	p_builder.append(p_name);
-	p_builder.append("\":\"");
-	p_builder.append(p_value);
-	p_builder.append("\"");
-}
+// Provides access to the live scene tree for _write_tree().
+struct LiveTree {
+	Node *root = nullptr;
 
-inline void _next_name_value_pair_new(sentry::util::UTF8Buffer &p_builder, const char *p_name, const String &p_value) {
-	p_builder.append(",\"");
-	p_builder.append(p_name);
-	p_builder.append("\":\"");
-	p_builder.append(p_value);
-	p_builder.append("\"");
-}
+	Node *get_root() const { return root; }
+	String get_name(Node *p_node) const { return p_node->get_name(); }
+	String get_class_name(Node *p_node) const { return p_node->get_class(); }
+	String get_scene_path(Node *p_node) const { return p_node->get_scene_file_path(); }
+	String get_script_path(Node *p_node) const {
+		const Ref<Script> &scr = p_node->get_script();
+		return scr.is_valid() ? scr->get_path() : String();
+	}
+	int get_child_count(Node *p_node) const { return p_node->get_child_count(); }
+	Node *get_child(Node *p_node, int p_index) const { return p_node->get_child(p_index); }
+};
+
+// Provides access to the mirrored scene tree for _write_tree(). Lock must be held.
+struct MirroredTree {
+	using Entry = sentry::SceneTreeMirror::Entry;
+
+	const sentry::SceneTreeMirror &mirror;
+
+	const Entry *get_root() const { return mirror.get_root(); }
+	const String &get_name(const Entry *p_entry) const { return p_entry->name; }
+	const String &get_class_name(const Entry *p_entry) const { return p_entry->class_name; }
+	const String &get_scene_path(const Entry *p_entry) const { return p_entry->scene_path; }
+	const String &get_script_path(const Entry *p_entry) const { return p_entry->script_path; }
+	int get_child_count(const Entry *p_entry) const { return int(p_entry->children.size()); }
+	const Entry *get_child(const Entry *p_entry, int p_index) const { return mirror.get_entry(p_entry->children[p_index]); }
+};
 
 } // unnamed namespace
 
 namespace sentry {
 
-sentry::util::UTF8Buffer ViewHierarchyBuilder::build_json() {
-	if (!sentry::engine_lifecycle::are_engine_singletons_ready()) {
-		// Too early to access scene tree.
-		return ::sentry::util::UTF8Buffer(0);
-	}
+template <typename TTree>
+bool ViewHierarchyBuilder::_write_tree(sentry::util::UTF8Buffer &p_buffer, const TTree &p_tree, const JSONWriter::Sink &p_sink) {
+	using NodePtr = decltype(p_tree.get_root());
 
-	SceneTree *sml = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
-	ERR_FAIL_NULL_V(sml, ::sentry::util::UTF8Buffer(0));
+	// Node with open "children" array.
+	struct Frame {
+		NodePtr node;
+		int child_count = 0;
+		int next_child = 0;
+		int written_children = 0;
+		std::vector<int> class_seen; // per collapse rule
+	};
 
-	sentry::util::UTF8Buffer buffer{ size_t(estimated_buffer_size) };
+	std::vector<Frame> stack;
+	int64_t nodes_written = 0;
+	bool truncated = false;
+	bool sink_ok = true;
+
+	auto pass_to_sink = [&](size_t p_min_size) {
+		if (p_sink && sink_ok && p_buffer.get_size() >= p_min_size) {
+			sink_ok = p_sink(p_buffer.ptr(), p_buffer.get_size());
+			p_buffer.clear();
+		}
+	};
 
-	buffer.append(R"({"rendering_system":"Godot","windows":[)");
+	// Writes node's attributes and opens its children array if it should be descended into.
+	auto begin_node = [&](NodePtr p_node, int p_depth) {
+		// Names are mostly unique, so they are escaped in place rather than cached.
+		p_buffer.append("{\"name\":");
+		JSONWriter::write_quoted(p_buffer, p_tree.get_name(p_node));
+		_append_fragment(p_buffer, class_fragments, ",\"class\":", p_tree.get_class_name(p_node));
 
-	List<Node *> stack;
-	List<int> hierarchy;
+		const String &scene_path = p_tree.get_scene_path(p_node);
+		if (!scene_path.is_empty()) {
+			_append_fragment(p_buffer, scene_fragments, ",\"scene\":", scene_path);
+		}
 
-	if (sml->get_root()) {
-		stack.push_back(sml->get_root());
-	}
+		const String &script_path = p_tree.get_script_path(p_node);
+		if (!script_path.is_empty()) {
+			_append_fragment(p_buffer, script_fragments, ",\"script\":", script_path);
+		}
 
-	while (!stack.is_empty()) {
-		if (buffer.ends_with("}")) {
-			buffer.append(",{");
+		nodes_written++;
+
+		int child_count = p_tree.get_child_count(p_node);
+		if (child_count == 0) {
+			p_buffer.append("}");
+		} else if (limits.max_depth > 0 && p_depth >= limits.max_depth) {
+			p_buffer.append(",\"children_omitted\":");
+			p_buffer.append(String::num_int64(child_count));
+			p_buffer.append("}");
+			truncated = true;
 		} else {
-			buffer.append("{");
+			p_buffer.append(",\"children\":[");
+			Frame frame;
+			frame.node = p_node;
+			frame.child_count = child_count;
+			frame.class_seen.resize(limits.collapse_rules.size());
+			stack.push_back(std::move(frame));
 		}
+	};
 
-		Node *node = stack.back()->get();
-		stack.pop_back();
+	p_buffer.append(R"({"rendering_system":"Godot","windows":[)");
 
-		_start_name_value_pair_new(buffer, "name", node->get_name());
-		_next_name_value_pair_new(buffer, "class", node->get_class());
+	if (p_tree.get_root()) {
+		begin_node(p_tree.get_root(), 0);
+	}
 
-		String scene_path = node->get_scene_file_path();
-		if (!scene_path.is_empty()) {
-			_next_name_value_pair_new(buffer, "scene", scene_path);
-		}
+	while (!stack.empty() && sink_ok) {
+		pass_to_sink(STREAM_CHUNK_SIZE);
 
-		const Ref<Script> &scr = node->get_script();
-		if (scr.is_valid()) {
-			_next_name_value_pair_new(buffer, "script", scr.is_valid() ? scr->get_path() : String());
-		}
+		Frame &frame = stack.back();
+		bool budget_left = limits.max_nodes <= 0 || nodes_written < limits.max_nodes;
 
-		if (node->get_child_count()) {
-			buffer.append(",\"children\":[");
-			for (int i = node->get_child_count() - 1; i >= 0; i--) {
-				stack.push_back(node->get_child(i));
+		if (frame.next_child < frame.child_count && budget_left) {
+			NodePtr child = p_tree.get_child(frame.node, frame.next_child++);
+			if (unlikely(!child)) {
+				continue; // not in the mirror
 			}
-			hierarchy.push_back(node->get_child_count());
-		} else {
-			buffer.append("}");
-			while (!hierarchy.is_empty() && (--hierarchy.back()->get()) == 0) {
-				buffer.append("]}");
-				hierarchy.pop_back();
+
+			if (!limits.collapse_rules.empty()) {
+				const int *rule = collapse_rule_index.getptr(p_tree.get_class_name(child));
+				if (rule && ++frame.class_seen[*rule] > limits.collapse_rules[*rule].max_siblings) {
+					continue; // collapsed, summarized when closing the parent
+				}
+			}
+
+			if (frame.written_children++ > 0) {
+				p_buffer.append(",");
 			}
+			begin_node(child, int(stack.size())); // invalidates frame
+			continue;
 		}
+
+		// Summarize collapsed siblings by class.
+		for (size_t i = 0; i < frame.class_seen.size(); i++) {
+			int collapsed = frame.class_seen[i] - limits.collapse_rules[i].max_siblings;
+			if (collapsed > 0) {
+				if (frame.written_children++ > 0) {
+					p_buffer.append(",");
+				}
+				p_buffer.append("{\"name\":");
+				JSONWriter::write_quoted(p_buffer, vformat("(%d more)", collapsed));
+				_append_fragment(p_buffer, class_fragments, ",\"class\":", limits.collapse_rules[i].class_name);
+				p_buffer.append(",\"collapsed_count\":");
+				p_buffer.append(String::num_int64(collapsed));
+				p_buffer.append("}");
+				truncated = true;
+			}
+		}
+
+		p_buffer.append("]");
+		int omitted = frame.child_count - frame.next_child;
+		if (omitted > 0) {
+			// Node budget exhausted.
+			p_buffer.append(",\"children_omitted\":");
+			p_buffer.append(String::num_int64(omitted));
+			truncated = true;
+		}
+		p_buffer.append("}");
+		stack.pop_back();
 	}
 
-	buffer.append("]}");
+	p_buffer.append("]");
+	if (truncated) {
+		p_buffer.append(",\"truncated\":true");
+	}
+	p_buffer.append("}");
+
+	if (p_sink) {
+		pass_to_sink(1);
+		return sink_ok;
+	}
 
 	// Update estimate
-	estimated_buffer_size = MAX(estimated_buffer_size, buffer.get_capacity());
+	estimated_buffer_size = MAX(estimated_buffer_size, p_buffer.get_capacity());
+	return true;
+}
+
+void ViewHierarchyBuilder::_append_fragment(sentry::util::UTF8Buffer &p_buffer, HashMap<String, std::string> &p_cache, const char *p_prefix, const String &p_value) {
+	const std::string *fragment = p_cache.getptr(p_value);
+	if (unlikely(!fragment)) {
+		if (p_cache.size() >= MAX_CACHED_FRAGMENTS) {
+			p_cache.clear();
+		}
+		sentry::util::UTF8Buffer encoded{ 256 };
+		encoded.append(p_prefix);
+		JSONWriter::write_quoted(encoded, p_value);
+		fragment = &p_cache.insert(p_value, std::string(encoded.ptr(), encoded.get_size()))->value;
+	}
+	p_buffer.append(fragment->data(), fragment->size());
+}
+
+void ViewHierarchyBuilder::set_limits(const Limits &p_limits) {
+	limits = p_limits;
+	collapse_rule_index.clear();
+	for (int i = 0; i < (int)limits.collapse_rules.size(); i++) {
+		collapse_rule_index[limits.collapse_rules[i].class_name] = i;
+	}
+}
+
+sentry::util::UTF8Buffer ViewHierarchyBuilder::build_json() {
+	if (!sentry::engine_lifecycle::are_engine_singletons_ready()) {
+		// Too early to access scene tree.
+		return ::sentry::util::UTF8Buffer(0);
+	}
+
+	SceneTree *sml = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_V(sml, ::sentry::util::UTF8Buffer(0));
+
+	sentry::util::UTF8Buffer buffer{ size_t(estimated_buffer_size) };
+
+	_write_tree(buffer, LiveTree{ sml->get_root() });
 
 	return buffer;
 }
 
+sentry::util::UTF8Buffer ViewHierarchyBuilder::build_json(const SceneTreeMirror &p_mirror) {
+	std::unique_lock lock = p_mirror.lock();
+
+	if (!p_mirror.get_root()) {
+		return ::sentry::util::UTF8Buffer(0);
+	}
+
+	sentry::util::UTF8Buffer buffer{ size_t(estimated_buffer_size) };
+	_write_tree(buffer, MirroredTree{ p_mirror });
+
+	return buffer;
+}
+
+bool ViewHierarchyBuilder::write_json(const JSONWriter::Sink &p_sink) {
+	if (!sentry::engine_lifecycle::are_engine_singletons_ready()) {
+		// Too early to access scene tree.
+		return true;
+	}
+
+	SceneTree *sml = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_V(sml, true);
+
+	sentry::util::UTF8Buffer buffer{ STREAM_CHUNK_SIZE * 2 };
+	return _write_tree(buffer, LiveTree{ sml->get_root() }, p_sink);
+}
+
+bool ViewHierarchyBuilder::write_json(const SceneTreeMirror &p_mirror, const JSONWriter::Sink &p_sink) {
+	std::unique_lock lock = p_mirror.lock();
+
+	if (!p_mirror.get_root()) {
+		return true;
+	}
+
+	sentry::util::UTF8Buffer buffer{ STREAM_CHUNK_SIZE * 2 };
+	return _write_tree(buffer, MirroredTree{ p_mirror }, p_sink);
+}
+
 } //namespace sentry
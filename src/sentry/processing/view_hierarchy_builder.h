@@ -1,19 +1,71 @@
 #pragma once
 
+#include "sentry/processing/scene_tree_mirror.h"
+#include "sentry/util/json_writer.h"
 #include "sentry/util/utf8_buffer.h"
 
+#include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <string>
+#include <vector>
 
 namespace sentry {
 
 class ViewHierarchyBuilder {
+public:
+	struct CollapseRule {
+		String class_name;
+		// Siblings of this class beyond this number are summarized as a count.
+		int max_siblings = 0;
+	};
+
+	// Bounds on the captured tree; omitted parts are reported in the JSON.
+	struct Limits {
+		int max_nodes = 0; // 0 means no limit
+		int max_depth = 0; // 0 means no limit
+		std::vector<CollapseRule> collapse_rules;
+	};
+
 private:
 	// Initial estimated buffer size for JSON serialization (bytes).
 	// This value is adjusted based on past data to minimize reallocations.
 	size_t estimated_buffer_size = 262'144;
 
+	Limits limits;
+	HashMap<String, int> collapse_rule_index;
+
+	// Pre-escaped UTF-8 fragments, such as `,"class":"Node3D"`, for values that repeat across nodes.
+	// Kept between captures; cleared if it grows past the limit.
+	static constexpr uint32_t MAX_CACHED_FRAGMENTS = 4096;
+	HashMap<String, std::string> class_fragments;
+	HashMap<String, std::string> scene_fragments;
+	HashMap<String, std::string> script_fragments;
+
+	static void _append_fragment(sentry::util::UTF8Buffer &p_buffer, HashMap<String, std::string> &p_cache, const char *p_prefix, const String &p_value);
+
+	// Output is passed to the sink in chunks of about this size when streaming.
+	static constexpr size_t STREAM_CHUNK_SIZE = 16 * 1024;
+
+	// Writes the tree into p_buffer, or streams it through p_buffer to p_sink if one is given.
+	// Returns false if the sink failed.
+	template <typename TTree>
+	bool _write_tree(sentry::util::UTF8Buffer &p_buffer, const TTree &p_tree, const sentry::util::JSONWriter::Sink &p_sink = {});
+
 public:
+	void set_limits(const Limits &p_limits);
+	const Limits &get_limits() const { return limits; }
+
+	// Walks the live scene tree. Main thread only.
 	sentry::util::UTF8Buffer build_json();
+
+	// Serializes the mirrored scene tree. Can be called from any thread.
+	sentry::util::UTF8Buffer build_json(const SceneTreeMirror &p_mirror);
+
+	// Same as build_json(), but streams the output to p_sink in chunks instead of keeping it in memory.
+	// Returns false if the sink failed; nothing is written if the tree isn't available.
+	// The mirror stays locked until the output is complete, so avoid slow sinks such as files while the game runs.
+	bool write_json(const sentry::util::JSONWriter::Sink &p_sink);
+	bool write_json(const SceneTreeMirror &p_mirror, const sentry::util::JSONWriter::Sink &p_sink);
 };
 
 } //namespace sentry
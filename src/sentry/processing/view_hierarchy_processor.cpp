@@ -1,12 +1,17 @@
 #include "view_hierarchy_processor.h"
 
 #include "sentry/common_defs.h"
+#include "sentry/engine_lifecycle/engine_lifecycle.h"
 #include "sentry/logging/print.h"
+#include "sentry/sentry_sdk.h"
 
 #include <chrono>
 #include <cstdio>
+#include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
 
 namespace sentry {
 
@@ -15,9 +20,12 @@ Ref<SentryEvent> ViewHierarchyProcessor::process_event(const Ref<SentryEvent> &p
 	auto start = std::chrono::high_resolution_clock::now();
 #endif
 
+	std::lock_guard lock{ capture_mutex };
+
 	std::remove(json_file_path.ptr());
 
-	if (OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id()) {
+	// The mirror can be serialized on any thread; the live tree only on the main thread.
+	if (!incremental && OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id()) {
 		sentry::logging::print_debug("Skipping scene tree capture - can only be performed on the main thread");
 		return p_event;
 	}
@@ -29,15 +37,26 @@ Ref<SentryEvent> ViewHierarchyProcessor::process_event(const Ref<SentryEvent> &p
 	}
 #endif
 
-	sentry::util::UTF8Buffer json_buffer = view_hierarchy_builder.build_json();
+	// The mirror is serialized into memory first, so that its lock isn't held during file I/O,
+	// which would block the main thread's scene tree signal handlers.
+	sentry::util::UTF8Buffer mirror_json = incremental
+			? view_hierarchy_builder.build_json(scene_tree_mirror)
+			: sentry::util::UTF8Buffer(0);
 
 	FILE *f = std::fopen(json_file_path.ptr(), "wb");
 	if (f) {
-		size_t written = std::fwrite(json_buffer.ptr(), 1, json_buffer.get_size(), f);
-		if (written != json_buffer.get_size()) {
-			sentry::logging::print_error(vformat("Failed to write scene tree data - only wrote %d bytes out of %d", (int64_t)written, (int64_t)json_buffer.get_size()));
+		bool ok = true;
+		if (incremental) {
+			ok = mirror_json.get_size() == 0 || std::fwrite(mirror_json.ptr(), 1, mirror_json.get_size(), f) == mirror_json.get_size();
+		} else {
+			// The live tree is streamed to the file in chunks, so large trees aren't held in memory as a whole.
+			ok = view_hierarchy_builder.write_json(sentry::util::JSONWriter::file_sink(f));
 		}
 		std::fclose(f);
+		if (!ok) {
+			sentry::logging::print_error("Failed to write scene tree data - write error");
+			std::remove(json_file_path.ptr());
+		}
 	} else {
 		sentry::logging::print_error(vformat("Failed to write scene tree data - unable to open file for writing: %s", json_file_path.get_data()));
 	}
@@ -51,7 +70,75 @@ Ref<SentryEvent> ViewHierarchyProcessor::process_event(const Ref<SentryEvent> &p
 	return p_event;
 }
 
+void ViewHierarchyProcessor::_connect_scene_tree() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to start incremental scene tree capture - SceneTree is unavailable.");
+
+	scene_tree_mirror.reset(scene_tree->get_root());
+
+	scene_tree->connect("node_added", callable_mp(this, &ViewHierarchyProcessor::_on_node_added));
+	scene_tree->connect("node_removed", callable_mp(this, &ViewHierarchyProcessor::_on_node_removed));
+	scene_tree->connect("node_renamed", callable_mp(this, &ViewHierarchyProcessor::_on_node_renamed));
+
+	sentry::logging::print_debug("Incremental scene tree capture started with ", (int64_t)scene_tree_mirror.size(), " nodes");
+}
+
+void ViewHierarchyProcessor::_disconnect_scene_tree() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	if (!scene_tree) {
+		return;
+	}
+
+	Callable on_added = callable_mp(this, &ViewHierarchyProcessor::_on_node_added);
+	if (scene_tree->is_connected("node_added", on_added)) {
+		scene_tree->disconnect("node_added", on_added);
+	}
+	Callable on_removed = callable_mp(this, &ViewHierarchyProcessor::_on_node_removed);
+	if (scene_tree->is_connected("node_removed", on_removed)) {
+		scene_tree->disconnect("node_removed", on_removed);
+	}
+	Callable on_renamed = callable_mp(this, &ViewHierarchyProcessor::_on_node_renamed);
+	if (scene_tree->is_connected("node_renamed", on_renamed)) {
+		scene_tree->disconnect("node_renamed", on_renamed);
+	}
+}
+
+void ViewHierarchyProcessor::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_POSTINITIALIZE: {
+			if (!incremental) {
+				return;
+			}
+			if (sentry::engine_lifecycle::are_engine_singletons_ready() &&
+					Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+				_connect_scene_tree();
+			} else {
+				// Defer signal connection since SceneTree is not available during early initialization.
+				callable_mp(this, &ViewHierarchyProcessor::_connect_scene_tree).call_deferred();
+			}
+		} break;
+		case NOTIFICATION_PREDELETE: {
+			if (incremental) {
+				_disconnect_scene_tree();
+				scene_tree_mirror.clear();
+			}
+		} break;
+	}
+}
+
 ViewHierarchyProcessor::ViewHierarchyProcessor() {
+	incremental = SENTRY_OPTIONS()->is_scene_tree_incremental_enabled();
+
+	ViewHierarchyBuilder::Limits limits;
+	limits.max_nodes = SENTRY_OPTIONS()->get_scene_tree_max_nodes();
+	limits.max_depth = SENTRY_OPTIONS()->get_scene_tree_max_depth();
+	Dictionary rules = SENTRY_OPTIONS()->get_scene_tree_collapse_rules();
+	Array classes = rules.keys();
+	for (int i = 0; i < classes.size(); i++) {
+		limits.collapse_rules.push_back({ String(classes[i]), MAX(0, int(rules[classes[i]])) });
+	}
+	view_hierarchy_builder.set_limits(limits);
+
 	String path = "user://" SENTRY_VIEW_HIERARCHY_FN;
 	ERR_FAIL_NULL(ProjectSettings::get_singleton());
 	json_file_path = String(ProjectSettings::get_singleton()->globalize_path(path)).utf8();
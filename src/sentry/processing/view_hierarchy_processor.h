@@ -1,9 +1,11 @@
 #pragma once
 
+#include "sentry/processing/scene_tree_mirror.h"
 #include "sentry/processing/sentry_event_processor.h"
 #include "sentry/processing/view_hierarchy_builder.h"
 
 #include <godot_cpp/variant/char_string.hpp>
+#include <mutex>
 
 namespace sentry {
 
@@ -15,8 +17,23 @@ private:
 	CharString json_file_path;
 	ViewHierarchyBuilder view_hierarchy_builder;
 
+	// Serializes captures, which may happen on multiple threads in incremental mode.
+	std::mutex capture_mutex;
+
+	// Incremental mode: scene tree is mirrored as it changes, and captured from the mirror.
+	bool incremental = false;
+	SceneTreeMirror scene_tree_mirror;
+
+	void _connect_scene_tree();
+	void _disconnect_scene_tree();
+
+	void _on_node_added(Node *p_node) { scene_tree_mirror.add_node(p_node); }
+	void _on_node_removed(Node *p_node) { scene_tree_mirror.remove_node(p_node); }
+	void _on_node_renamed(Node *p_node) { scene_tree_mirror.rename_node(p_node); }
+
 protected:
 	static void _bind_methods() {}
+	void _notification(int p_what);
 
 public:
 	virtual Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) override;
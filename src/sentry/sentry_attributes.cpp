@@ -0,0 +1,128 @@
+#include "sentry_attributes.h"
+
+#include "sentry/util/hash.h"
+
+#include <cstring>
+
+namespace sentry {
+
+namespace {
+
+// Finalizer from SplitMix64, so that summed pair hashes stay well distributed.
+_FORCE_INLINE_ uint64_t _mix(uint64_t p_hash) {
+	p_hash ^= p_hash >> 30;
+	p_hash *= 0xbf58476d1ce4e5b9ull;
+	p_hash ^= p_hash >> 27;
+	p_hash *= 0x94d049bb133111ebull;
+	p_hash ^= p_hash >> 31;
+	return p_hash;
+}
+
+} // unnamed namespace
+
+Ref<SentryAttributes> SentryAttributes::create(const Dictionary &p_attributes) {
+	Ref<SentryAttributes> instance;
+	instance.instantiate();
+
+	Dictionary attributes;
+	for (const Variant &key : p_attributes.keys()) {
+		String name = key.stringify();
+		ERR_CONTINUE_MSG(name.is_empty(), "Sentry: Can't set attribute with an empty name.");
+
+		const Variant &value = p_attributes[key];
+		Entry entry;
+		entry.name = name.utf8();
+		entry.type = value.get_type();
+		switch (entry.type) {
+			case Variant::BOOL: {
+				entry.bool_value = value;
+			} break;
+			case Variant::INT: {
+				entry.int_value = value;
+			} break;
+			case Variant::FLOAT: {
+				entry.float_value = value;
+			} break;
+			default: {
+				// Other types are sent as strings.
+				entry.type = Variant::STRING;
+				entry.string_value = value.stringify().utf8();
+			} break;
+		}
+		instance->entries.push_back(entry);
+		attributes[name] = value;
+	}
+
+	attributes.make_read_only();
+	instance->attributes = attributes;
+	instance->hash = hash_dictionary(attributes);
+	return instance;
+}
+
+bool SentryAttributes::unpack(const Variant &p_attributes, Dictionary &r_dictionary, Ref<SentryAttributes> &r_compiled) {
+	switch (p_attributes.get_type()) {
+		case Variant::NIL: {
+			return true;
+		} break;
+		case Variant::DICTIONARY: {
+			r_dictionary = p_attributes;
+			return true;
+		} break;
+		case Variant::OBJECT: {
+			r_compiled = p_attributes;
+			ERR_FAIL_COND_V_MSG(r_compiled.is_null(), false, "Sentry: Attributes must be a Dictionary or SentryAttributes.");
+			return true;
+		} break;
+		default: {
+			ERR_FAIL_V_MSG(false, "Sentry: Attributes must be a Dictionary or SentryAttributes.");
+		} break;
+	}
+}
+
+uint64_t SentryAttributes::hash_dictionary(const Dictionary &p_attributes) {
+	// Each name/value pair is hashed on its own and the results are summed, so the order doesn't matter.
+	uint64_t result = 0;
+	for (const Variant &key : p_attributes.keys()) {
+		String name = key.stringify();
+		if (name.is_empty()) {
+			continue; // skipped by create() as well
+		}
+		uint64_t pair = util::fnv1a_hash64(name.ptr(), name.length());
+		pair = util::fnv1a_hash64(uint64_t(name.length()), pair);
+
+		// Same conversion as in create().
+		const Variant &value = p_attributes[key];
+		switch (value.get_type()) {
+			case Variant::BOOL: {
+				pair = util::fnv1a_hash64(uint64_t(Variant::BOOL), pair);
+				pair = util::fnv1a_hash64(uint64_t(value.operator bool()), pair);
+			} break;
+			case Variant::INT: {
+				pair = util::fnv1a_hash64(uint64_t(Variant::INT), pair);
+				pair = util::fnv1a_hash64(uint64_t(value.operator int64_t()), pair);
+			} break;
+			case Variant::FLOAT: {
+				double number = value;
+				uint64_t bits;
+				std::memcpy(&bits, &number, sizeof(bits));
+				pair = util::fnv1a_hash64(uint64_t(Variant::FLOAT), pair);
+				pair = util::fnv1a_hash64(bits, pair);
+			} break;
+			default: {
+				String str = value.stringify();
+				pair = util::fnv1a_hash64(uint64_t(Variant::STRING), pair);
+				pair = util::fnv1a_hash64(str.ptr(), str.length(), pair);
+			} break;
+		}
+		result += _mix(pair);
+	}
+	return result;
+}
+
+void SentryAttributes::_bind_methods() {
+	ClassDB::bind_static_method("SentryAttributes", D_METHOD("create", "attributes"), &SentryAttributes::create);
+	ClassDB::bind_method(D_METHOD("get_dictionary"), &SentryAttributes::get_dictionary);
+	ClassDB::bind_method(D_METHOD("is_empty"), &SentryAttributes::is_empty);
+}
+
+} // namespace sentry
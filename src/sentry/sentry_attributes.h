@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/char_string.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <vector>
+
+using namespace godot;
+
+namespace sentry {
+
+// Immutable set of attributes for logs and metrics, encoded once and reused across calls.
+class SentryAttributes : public RefCounted {
+	GDCLASS(SentryAttributes, RefCounted);
+
+public:
+	// Attribute value converted to one of the supported types, with UTF-8 name and string value.
+	struct Entry {
+		CharString name;
+		Variant::Type type = Variant::NIL;
+		bool bool_value = false;
+		int64_t int_value = 0;
+		double float_value = 0.0;
+		CharString string_value;
+	};
+
+private:
+	Dictionary attributes;
+	std::vector<Entry> entries;
+	uint64_t hash = 0;
+
+protected:
+	static void _bind_methods();
+
+public:
+	static Ref<SentryAttributes> create(const Dictionary &p_attributes);
+
+	// Splits attributes passed to public API, which can be either a Dictionary or SentryAttributes.
+	static bool unpack(const Variant &p_attributes, Dictionary &r_dictionary, Ref<SentryAttributes> &r_compiled);
+
+	// Hash of attribute names and values as they are sent, so it doesn't depend on insertion order
+	// or on whether names are String or StringName; 0 if empty.
+	static uint64_t hash_dictionary(const Dictionary &p_attributes);
+
+	// Read-only.
+	const Dictionary &get_attributes() const { return attributes; }
+	const std::vector<Entry> &get_entries() const { return entries; }
+	uint64_t get_hash() const { return hash; }
+	bool is_empty() const { return entries.empty(); }
+
+	Dictionary get_dictionary() const { return attributes; }
+};
+
+} // namespace sentry
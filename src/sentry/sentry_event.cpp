@@ -1,11 +1,42 @@
 #include "sentry_event.h"
 
 #include "sentry/sentry_sdk.h" // Needed for VariantCaster<SentrySDK::Level>
+#include "sentry/util/variant_budget.h"
 
 #include <godot_cpp/classes/global_constants.hpp>
 
 namespace sentry {
 
+Vector<Pair<String, Variant>> SentryEvent::Exception::get_frame_variables(int p_frame_index) const {
+	ERR_FAIL_INDEX_V(p_frame_index, frames.size(), Vector<Pair<String, Variant>>());
+
+	int globals_frame_index = -1;
+	if (!globals.is_empty()) {
+		for (int i = frames.size() - 1; i >= 0; i--) {
+			if (frames[i].in_app) {
+				globals_frame_index = i;
+				break;
+			}
+		}
+	}
+
+	const Vector<Pair<String, Variant>> &frame_vars = frames[p_frame_index].vars;
+	bool with_globals = p_frame_index == globals_frame_index;
+
+	Vector<Pair<String, Variant>> result;
+	result.resize(frame_vars.size() + (with_globals ? globals.size() : 0));
+	Pair<String, Variant> *ptrw = result.ptrw();
+	for (const Pair<String, Variant> &var : frame_vars) {
+		*ptrw++ = Pair(var.first, sentry::util::fit_variant_to_budget(var.second));
+	}
+	if (with_globals) {
+		for (const Pair<String, Variant> &var : globals) {
+			*ptrw++ = Pair(var.first, sentry::util::fit_variant_to_budget(var.second));
+		}
+	}
+	return result;
+}
+
 void SentryEvent::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_id"), &SentryEvent::get_id);
 	ClassDB::bind_method(D_METHOD("set_message", "message"), &SentryEvent::set_message);
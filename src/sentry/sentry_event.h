@@ -26,6 +26,7 @@ public:
 		bool in_app = true;
 		String platform;
 		String context_line;
+		// Local and member variables, as captured. Serialized by the backend.
 		Vector<Pair<String, Variant>> vars;
 		PackedStringArray pre_context;
 		PackedStringArray post_context;
@@ -35,6 +36,12 @@ public:
 		String type;
 		String value;
 		Vector<StackFrame> frames;
+		// Global variables, shared by all frames, so they are kept only once.
+		Vector<Pair<String, Variant>> globals;
+
+		// Returns variables to serialize for the frame, with values fitted to the variable budgets.
+		// Globals are included only with the most recent in-app frame.
+		Vector<Pair<String, Variant>> get_frame_variables(int p_frame_index) const;
 	};
 
 protected:
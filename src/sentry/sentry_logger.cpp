@@ -1,14 +1,36 @@
 #include "sentry_logger.h"
 
+#include "sentry/logging/print.h"
 #include "sentry/sentry_log.h" // Needed for VariantCaster<LogLevel>
 #include "sentry/sentry_sdk.h"
 
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
+
 namespace sentry {
 
-void SentryLogger::log(LogLevel p_level, const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
+void SentryLogger::log(LogLevel p_level, const String &p_body, const Array &p_params, const Variant &p_attributes) {
+	Dictionary user_attributes;
+	Ref<SentryAttributes> compiled;
+	ERR_FAIL_COND(!SentryAttributes::unpack(p_attributes, user_attributes, compiled));
+
+	// Check limits before formatting, so that suppressed logs are cheap. Logs with the same template count as identical.
+	if (rate_limiter.is_enabled()) {
+		const Dictionary &origin_source = compiled.is_valid() ? compiled->get_attributes() : user_attributes;
+		if (!_acquire(p_level, origin_source.get("sentry.origin", Variant()), p_body)) {
+			return;
+		}
+	}
+
+	if (compiled.is_valid() && p_params.is_empty()) {
+		_send(SentrySDK::get_singleton()->get_current_scope(), p_level, p_body, compiled);
+		return;
+	}
+
 	String body = p_body;
 	Dictionary attributes;
-	attributes.merge(p_attributes);
+	attributes.merge(compiled.is_valid() ? compiled->get_attributes() : user_attributes);
 	if (!p_params.is_empty()) {
 		attributes["sentry.message.template"] = p_body;
 		for (int i = 0; i < p_params.size(); i++) {
@@ -17,33 +39,187 @@ void SentryLogger::log(LogLevel p_level, const String &p_body, const Array &p_pa
 		}
 		body = p_body % p_params;
 	}
-	INTERNAL_SDK()->capture_log(SentrySDK::get_singleton()->get_current_scope(), p_level, body, attributes);
+	_send(SentrySDK::get_singleton()->get_current_scope(), p_level, body, attributes);
 }
 
-void SentryLogger::trace(const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
+void SentryLogger::trace(const String &p_body, const Array &p_params, const Variant &p_attributes) {
 	log(LOG_LEVEL_TRACE, p_body, p_params, p_attributes);
 }
 
-void SentryLogger::debug(const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
+void SentryLogger::debug(const String &p_body, const Array &p_params, const Variant &p_attributes) {
 	log(LOG_LEVEL_DEBUG, p_body, p_params, p_attributes);
 }
 
-void SentryLogger::info(const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
+void SentryLogger::info(const String &p_body, const Array &p_params, const Variant &p_attributes) {
 	log(LOG_LEVEL_INFO, p_body, p_params, p_attributes);
 }
 
-void SentryLogger::warn(const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
+void SentryLogger::warn(const String &p_body, const Array &p_params, const Variant &p_attributes) {
 	log(LOG_LEVEL_WARN, p_body, p_params, p_attributes);
 }
 
-void SentryLogger::error(const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
+void SentryLogger::error(const String &p_body, const Array &p_params, const Variant &p_attributes) {
 	log(LOG_LEVEL_ERROR, p_body, p_params, p_attributes);
 }
 
-void SentryLogger::fatal(const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
+void SentryLogger::fatal(const String &p_body, const Array &p_params, const Variant &p_attributes) {
 	log(LOG_LEVEL_FATAL, p_body, p_params, p_attributes);
 }
 
+void SentryLogger::capture(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes) {
+	if (rate_limiter.is_enabled() && !_acquire(p_level, p_attributes.get("sentry.origin", Variant()), p_body)) {
+		return;
+	}
+	_send(p_scope, p_level, p_body, p_attributes);
+}
+
+void SentryLogger::capture(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Ref<SentryAttributes> &p_attributes) {
+	if (rate_limiter.is_enabled() && !_acquire(p_level, p_attributes.is_valid() ? p_attributes->get_attributes().get("sentry.origin", Variant()) : Variant(), p_body)) {
+		return;
+	}
+	_send(p_scope, p_level, p_body, p_attributes);
+}
+
+void SentryLogger::configure_rate_limits(const Dictionary &p_limits) {
+	rate_limiter.configure(p_limits);
+}
+
+bool SentryLogger::_acquire(LogLevel p_level, const Variant &p_origin, const String &p_body) {
+	String origin = p_origin.get_type() == Variant::NIL ? String("manual") : p_origin.stringify();
+	if (rate_limiter.try_acquire(p_level, origin, p_body, Time::get_singleton()->get_ticks_usec())) {
+		return true;
+	}
+	// Suppressed logs are reported from the main thread.
+	_request_flush_hook();
+	return false;
+}
+
+void SentryLogger::_send(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes) {
+	if (SENTRY_OPTIONS()->get_log_batch_interval_ms() > 0) {
+		// Dictionaries passed here are built for this log, so they are stored as is.
+		_append(p_scope, p_level, p_body, p_attributes, Ref<SentryAttributes>());
+		return;
+	}
+	INTERNAL_SDK()->capture_log(p_scope, p_level, p_body, p_attributes);
+}
+
+void SentryLogger::_send(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Ref<SentryAttributes> &p_attributes) {
+	if (SENTRY_OPTIONS()->get_log_batch_interval_ms() > 0) {
+		_append(p_scope, p_level, p_body, Dictionary(), p_attributes);
+		return;
+	}
+	if (p_attributes.is_valid()) {
+		INTERNAL_SDK()->capture_log_compiled(p_scope, p_level, p_body, p_attributes);
+	} else {
+		INTERNAL_SDK()->capture_log(p_scope, p_level, p_body);
+	}
+}
+
+void SentryLogger::_append(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes, const Ref<SentryAttributes> &p_compiled) {
+	batcher.set_batch_size(SENTRY_OPTIONS()->get_log_batch_size());
+	// Scopes belong to their thread – the batch is sent from the main thread with a snapshot of this one.
+	Ref<SentryScope> scope = p_scope.is_valid() ? p_scope->clone() : p_scope;
+	batcher.append({ scope, Time::get_singleton()->get_unix_time_from_system(), p_level, p_body, p_attributes, p_compiled });
+	_request_flush_hook();
+}
+
+void SentryLogger::_send_rate_limit_summaries(bool p_force) {
+	std::vector<logging::LogRateLimiter::Summary> summaries;
+	rate_limiter.take_summaries(Time::get_singleton()->get_ticks_usec(), p_force, summaries);
+	if (summaries.empty()) {
+		return;
+	}
+
+	Ref<SentryScope> scope = SentrySDK::get_singleton()->get_current_scope();
+	for (const logging::LogRateLimiter::Summary &summary : summaries) {
+		String body = summary.body;
+		if (summary.count > 1) {
+			body += summary.same_body
+					? vformat(" (%d more similar)", summary.count - 1)
+					: vformat(" (%d more logs suppressed by rate limiting)", summary.count - 1);
+		}
+		Dictionary attributes;
+		if (!summary.origin.is_empty()) {
+			attributes["sentry.origin"] = summary.origin;
+		}
+		attributes["sentry.godot.rate_limited_count"] = summary.count;
+		_send(scope, summary.level, body, attributes);
+	}
+}
+
+void SentryLogger::_flush_batch(bool p_crash) {
+	auto capture = [](const logging::LogBatcher::Record &p_record) {
+		INTERNAL_SDK()->capture_log_at(p_record.scope, p_record.timestamp, p_record.level, p_record.body, p_record.attributes, p_record.compiled);
+	};
+	batcher.flush(capture, p_crash);
+
+	if (p_crash) {
+		return;
+	}
+
+	uint64_t dropped = batcher.take_unreported_dropped_count();
+	if (dropped > 0) {
+		sentry::logging::print_warning(vformat("Dropped %d structured logs because the log batch buffer was full (%d logs dropped in total).",
+				int64_t(dropped), int64_t(batcher.get_dropped_count())));
+	}
+}
+
+void SentryLogger::flush() {
+	_send_rate_limit_summaries(true);
+	_flush_batch();
+}
+
+void SentryLogger::flush_before_event(bool p_crash) {
+	_flush_batch(p_crash);
+}
+
+void SentryLogger::_request_flush_hook() {
+	if (!flush_hook_requested.exchange(true, std::memory_order_relaxed)) {
+		// Logs can be captured from any thread, so connect on the main thread.
+		callable_mp(this, &SentryLogger::_connect_process_frame).call_deferred();
+	}
+}
+
+void SentryLogger::_connect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to schedule sending of logs - SceneTree is unavailable.");
+
+	Callable callable = callable_mp(this, &SentryLogger::_process_frame);
+	if (!scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->connect("process_frame", callable);
+	}
+}
+
+void SentryLogger::_disconnect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Callable callable = callable_mp(this, &SentryLogger::_process_frame);
+	if (scene_tree && scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->disconnect("process_frame", callable);
+	}
+}
+
+void SentryLogger::_process_frame() {
+	if (rate_limiter.has_suppressed_logs()) {
+		_send_rate_limit_summaries(false);
+	}
+
+	// If batching was disabled in the meantime, the interval is 0 and remaining logs are sent right away.
+	int interval_ms = SENTRY_OPTIONS()->get_log_batch_interval_ms();
+	if (batcher.try_start_flush(Time::get_singleton()->get_ticks_msec(), MAX(interval_ms, 0))) {
+		_flush_batch();
+	}
+}
+
+void SentryLogger::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_PREDELETE: {
+			if (flush_hook_requested.load(std::memory_order_relaxed)) {
+				_disconnect_process_frame();
+			}
+		} break;
+	}
+}
+
 void SentryLogger::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("log", "level", "body", "parameters", "attributes"), &SentryLogger::log, DEFVAL(Array()), DEFVAL(Dictionary()));
 	ClassDB::bind_method(D_METHOD("trace", "body", "parameters", "attributes"), &SentryLogger::trace, DEFVAL(Array()), DEFVAL(Dictionary()));
@@ -1,7 +1,12 @@
 #pragma once
 
 #include "sentry/log_level.h"
+#include "sentry/logging/log_batcher.h"
+#include "sentry/logging/log_rate_limiter.h"
+#include "sentry/sentry_attributes.h"
+#include "sentry/sentry_scope.h"
 
+#include <atomic>
 #include <godot_cpp/classes/object.hpp>
 
 using namespace godot;
@@ -12,17 +17,53 @@ namespace sentry {
 class SentryLogger : public Object {
 	GDCLASS(SentryLogger, Object);
 
+private:
+	logging::LogBatcher batcher;
+	logging::LogRateLimiter rate_limiter;
+	std::atomic<bool> flush_hook_requested{ false };
+
+	// Returns false if the log is suppressed by rate limits.
+	bool _acquire(LogLevel p_level, const Variant &p_origin, const String &p_body);
+	void _send(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes);
+	void _send(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Ref<SentryAttributes> &p_attributes);
+	void _append(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes, const Ref<SentryAttributes> &p_compiled);
+	void _send_rate_limit_summaries(bool p_force);
+	// When crashing, skips buffers locked by other threads and doesn't report dropped logs.
+	void _flush_batch(bool p_crash = false);
+
+	void _request_flush_hook();
+	void _connect_process_frame();
+	void _disconnect_process_frame();
+	void _process_frame();
+
 protected:
 	static void _bind_methods();
+	void _notification(int p_what);
 
 public:
-	void log(LogLevel p_level, const String &p_body, const Array &p_params = Array(), const Dictionary &p_attributes = Dictionary());
-	void trace(const String &p_body, const Array &p_params = Array(), const Dictionary &p_attributes = Dictionary());
-	void debug(const String &p_body, const Array &p_params = Array(), const Dictionary &p_attributes = Dictionary());
-	void info(const String &p_body, const Array &p_params = Array(), const Dictionary &p_attributes = Dictionary());
-	void warn(const String &p_body, const Array &p_params = Array(), const Dictionary &p_attributes = Dictionary());
-	void error(const String &p_body, const Array &p_params = Array(), const Dictionary &p_attributes = Dictionary());
-	void fatal(const String &p_body, const Array &p_params = Array(), const Dictionary &p_attributes = Dictionary());
+	// Attributes can be a Dictionary or SentryAttributes.
+	void log(LogLevel p_level, const String &p_body, const Array &p_params = Array(), const Variant &p_attributes = Dictionary());
+	void trace(const String &p_body, const Array &p_params = Array(), const Variant &p_attributes = Dictionary());
+	void debug(const String &p_body, const Array &p_params = Array(), const Variant &p_attributes = Dictionary());
+	void info(const String &p_body, const Array &p_params = Array(), const Variant &p_attributes = Dictionary());
+	void warn(const String &p_body, const Array &p_params = Array(), const Variant &p_attributes = Dictionary());
+	void error(const String &p_body, const Array &p_params = Array(), const Variant &p_attributes = Dictionary());
+	void fatal(const String &p_body, const Array &p_params = Array(), const Variant &p_attributes = Dictionary());
+
+	// Sends a log to the backend, or adds it to the current batch if batching is enabled.
+	// Logs over the rate limits are dropped and reported later in a summary. Batched attribute dictionaries are stored
+	// without copying, so callers must not modify them afterwards. Thread-safe.
+	void capture(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Dictionary &p_attributes);
+	void capture(const Ref<SentryScope> &p_scope, LogLevel p_level, const String &p_body, const Ref<SentryAttributes> &p_attributes);
+
+	// Takes logs per second keyed by level name. See SentryOptions.log_rate_limits.
+	void configure_rate_limits(const Dictionary &p_limits);
+
+	// Sends batched logs and summaries of rate-limited logs now.
+	void flush();
+
+	// Sends batched logs ahead of an event, so that they aren't reported after it or lost when crashing.
+	void flush_before_event(bool p_crash);
 
 	SentryLogger();
 };
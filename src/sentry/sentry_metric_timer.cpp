@@ -0,0 +1,47 @@
+#include "sentry_metric_timer.h"
+
+#include "sentry/sentry_sdk.h"
+
+#include <godot_cpp/classes/time.hpp>
+
+namespace sentry {
+
+Ref<SentryMetricTimer> SentryMetricTimer::start(const String &p_name, const Variant &p_attributes) {
+	Ref<SentryMetricTimer> timer;
+	timer.instantiate();
+	timer->name = p_name;
+	timer->attributes = p_attributes;
+	timer->running = true;
+	// Sampled last, so that setting up the timer isn't measured.
+	timer->start_usec = Time::get_singleton()->get_ticks_usec();
+	return timer;
+}
+
+double SentryMetricTimer::stop() {
+	uint64_t now_usec = Time::get_singleton()->get_ticks_usec();
+	ERR_FAIL_COND_V_MSG(!running, 0.0, "SentryMetricTimer.stop(): timer is not running.");
+	running = false;
+
+	double elapsed_ms = (now_usec - start_usec) * 0.001;
+	if (SentrySDK::get_singleton() && SentrySDK::get_singleton()->get_metrics()) {
+		SentrySDK::get_singleton()->get_metrics()->distribution(name, elapsed_ms, "millisecond", attributes);
+	}
+	return elapsed_ms;
+}
+
+double SentryMetricTimer::get_elapsed_ms() const {
+	if (!running) {
+		return 0.0;
+	}
+	return (Time::get_singleton()->get_ticks_usec() - start_usec) * 0.001;
+}
+
+void SentryMetricTimer::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("stop"), &SentryMetricTimer::stop);
+	ClassDB::bind_method(D_METHOD("cancel"), &SentryMetricTimer::cancel);
+	ClassDB::bind_method(D_METHOD("get_elapsed_ms"), &SentryMetricTimer::get_elapsed_ms);
+	ClassDB::bind_method(D_METHOD("is_running"), &SentryMetricTimer::is_running);
+	ClassDB::bind_method(D_METHOD("get_name"), &SentryMetricTimer::get_name);
+}
+
+} // namespace sentry
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <godot_cpp/classes/ref_counted.hpp>
+
+using namespace godot;
+
+namespace sentry {
+
+// Measures elapsed time and records it as a distribution metric in milliseconds when stopped.
+// Created with SentryMetrics::start_timer().
+class SentryMetricTimer : public RefCounted {
+	GDCLASS(SentryMetricTimer, RefCounted);
+
+private:
+	String name;
+	Variant attributes; // Dictionary or SentryAttributes
+	uint64_t start_usec = 0;
+	bool running = false;
+
+protected:
+	static void _bind_methods();
+
+public:
+	static Ref<SentryMetricTimer> start(const String &p_name, const Variant &p_attributes);
+
+	// Records the duration and returns it in milliseconds.
+	double stop();
+
+	// Stops the timer without recording the duration.
+	void cancel() { running = false; }
+
+	double get_elapsed_ms() const;
+	_FORCE_INLINE_ bool is_running() const { return running; }
+	_FORCE_INLINE_ String get_name() const { return name; }
+};
+
+} // namespace sentry
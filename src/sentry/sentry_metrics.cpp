@@ -2,36 +2,160 @@
 
 #include "sentry/sentry_sdk.h"
 
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
+
 namespace sentry {
 
-void SentryMetrics::count(const String &p_name, int64_t p_value, const Dictionary &p_attributes) {
+void SentryMetrics::count(const String &p_name, int64_t p_value, const Variant &p_attributes) {
 	ERR_FAIL_COND_MSG(p_name.is_empty(), "SentryMetrics.count(): metric name must not be empty.");
 	if (!SENTRY_OPTIONS()->get_enable_metrics()) {
 		return;
 	}
-	INTERNAL_SDK()->metrics_add_count(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, p_attributes);
+	Dictionary attributes;
+	Ref<SentryAttributes> compiled;
+	ERR_FAIL_COND(!SentryAttributes::unpack(p_attributes, attributes, compiled));
+
+	if (SENTRY_OPTIONS()->get_metrics_aggregation_interval_ms() > 0) {
+		bool aggregated = compiled.is_valid()
+				? aggregator.add_count(p_name, p_value, compiled->get_attributes(), compiled->get_hash())
+				: aggregator.add_count(p_name, p_value, attributes, SentryAttributes::hash_dictionary(attributes));
+		if (aggregated) {
+			_request_flush_hook();
+			return;
+		}
+	}
+
+	if (compiled.is_valid()) {
+		INTERNAL_SDK()->metrics_add_count_compiled(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, compiled);
+	} else {
+		INTERNAL_SDK()->metrics_add_count(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, attributes);
+	}
 }
 
-void SentryMetrics::gauge(const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) {
+void SentryMetrics::gauge(const String &p_name, double p_value, const String &p_unit, const Variant &p_attributes) {
 	ERR_FAIL_COND_MSG(p_name.is_empty(), "SentryMetrics.gauge(): metric name must not be empty.");
 	if (!SENTRY_OPTIONS()->get_enable_metrics()) {
 		return;
 	}
-	INTERNAL_SDK()->metrics_add_gauge(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, p_unit, p_attributes);
+	Dictionary attributes;
+	Ref<SentryAttributes> compiled;
+	ERR_FAIL_COND(!SentryAttributes::unpack(p_attributes, attributes, compiled));
+
+	if (SENTRY_OPTIONS()->get_metrics_aggregation_interval_ms() > 0) {
+		bool aggregated = compiled.is_valid()
+				? aggregator.add_gauge(p_name, p_value, p_unit, compiled->get_attributes(), compiled->get_hash())
+				: aggregator.add_gauge(p_name, p_value, p_unit, attributes, SentryAttributes::hash_dictionary(attributes));
+		if (aggregated) {
+			_request_flush_hook();
+			return;
+		}
+	}
+
+	if (compiled.is_valid()) {
+		INTERNAL_SDK()->metrics_add_gauge_compiled(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, p_unit, compiled);
+	} else {
+		INTERNAL_SDK()->metrics_add_gauge(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, p_unit, attributes);
+	}
 }
 
-void SentryMetrics::distribution(const String &p_name, double p_value, const String &p_unit, const Dictionary &p_attributes) {
+void SentryMetrics::distribution(const String &p_name, double p_value, const String &p_unit, const Variant &p_attributes) {
 	ERR_FAIL_COND_MSG(p_name.is_empty(), "SentryMetrics.distribution(): metric name must not be empty.");
 	if (!SENTRY_OPTIONS()->get_enable_metrics()) {
 		return;
 	}
-	INTERNAL_SDK()->metrics_add_distribution(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, p_unit, p_attributes);
+	Dictionary attributes;
+	Ref<SentryAttributes> compiled;
+	ERR_FAIL_COND(!SentryAttributes::unpack(p_attributes, attributes, compiled));
+
+	if (SENTRY_OPTIONS()->get_metrics_aggregation_interval_ms() > 0) {
+		bool aggregated = compiled.is_valid()
+				? aggregator.add_distribution(p_name, p_value, p_unit, compiled->get_attributes(), compiled->get_hash())
+				: aggregator.add_distribution(p_name, p_value, p_unit, attributes, SentryAttributes::hash_dictionary(attributes));
+		if (aggregated) {
+			_request_flush_hook();
+			return;
+		}
+	}
+
+	if (compiled.is_valid()) {
+		INTERNAL_SDK()->metrics_add_distribution_compiled(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, p_unit, compiled);
+	} else {
+		INTERNAL_SDK()->metrics_add_distribution(SentrySDK::get_singleton()->get_current_scope(), p_name, p_value, p_unit, attributes);
+	}
+}
+
+Ref<SentryMetricTimer> SentryMetrics::start_timer(const String &p_name, const Variant &p_attributes) {
+	ERR_FAIL_COND_V_MSG(p_name.is_empty(), Ref<SentryMetricTimer>(), "SentryMetrics.start_timer(): metric name must not be empty.");
+	return SentryMetricTimer::start(p_name, p_attributes);
+}
+
+void SentryMetrics::flush() {
+	Ref<SentryScope> scope = SentrySDK::get_singleton()->get_current_scope();
+	aggregator.flush([&scope](const MetricAggregator::Item &p_item) {
+		switch (p_item.type) {
+			case SentryMetric::METRIC_COUNTER: {
+				INTERNAL_SDK()->metrics_add_count(scope, p_item.name, p_item.count_value, p_item.attributes);
+			} break;
+			case SentryMetric::METRIC_GAUGE: {
+				INTERNAL_SDK()->metrics_add_gauge(scope, p_item.name, p_item.value, p_item.unit, p_item.attributes);
+			} break;
+			case SentryMetric::METRIC_DISTRIBUTION: {
+				INTERNAL_SDK()->metrics_add_distribution(scope, p_item.name, p_item.value, p_item.unit, p_item.attributes);
+			} break;
+		}
+	});
+}
+
+void SentryMetrics::_request_flush_hook() {
+	if (!flush_hook_requested.exchange(true, std::memory_order_relaxed)) {
+		// Metrics can be emitted from any thread, so connect on the main thread.
+		callable_mp(this, &SentryMetrics::_connect_process_frame).call_deferred();
+	}
+}
+
+void SentryMetrics::_connect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to schedule metric flushing - SceneTree is unavailable.");
+
+	Callable callable = callable_mp(this, &SentryMetrics::_process_frame);
+	if (!scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->connect("process_frame", callable);
+	}
+}
+
+void SentryMetrics::_disconnect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Callable callable = callable_mp(this, &SentryMetrics::_process_frame);
+	if (scene_tree && scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->disconnect("process_frame", callable);
+	}
+}
+
+void SentryMetrics::_process_frame() {
+	// Keep flushing at the default interval if aggregation was disabled in the meantime.
+	int interval_ms = SENTRY_OPTIONS()->get_metrics_aggregation_interval_ms();
+	if (aggregator.try_start_flush(Time::get_singleton()->get_ticks_msec(), interval_ms > 0 ? interval_ms : 1000)) {
+		flush();
+	}
+}
+
+void SentryMetrics::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_PREDELETE: {
+			if (flush_hook_requested.load(std::memory_order_relaxed)) {
+				_disconnect_process_frame();
+			}
+		} break;
+	}
 }
 
 void SentryMetrics::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("count", "name", "value", "attributes"), &SentryMetrics::count, DEFVAL(1), DEFVAL(Dictionary()));
 	ClassDB::bind_method(D_METHOD("gauge", "name", "value", "unit", "attributes"), &SentryMetrics::gauge, DEFVAL(String()), DEFVAL(Dictionary()));
 	ClassDB::bind_method(D_METHOD("distribution", "name", "value", "unit", "attributes"), &SentryMetrics::distribution, DEFVAL(String()), DEFVAL(Dictionary()));
+	ClassDB::bind_method(D_METHOD("start_timer", "name", "attributes"), &SentryMetrics::start_timer, DEFVAL(Dictionary()));
 }
 
 } // namespace sentry
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "sentry/metric_aggregator.h"
+#include "sentry/sentry_metric_timer.h"
+
+#include <atomic>
 #include <godot_cpp/classes/object.hpp>
 
 using namespace godot;
@@ -9,13 +13,30 @@ namespace sentry {
 class SentryMetrics : public Object {
 	GDCLASS(SentryMetrics, Object);
 
+private:
+	MetricAggregator aggregator;
+	std::atomic<bool> flush_hook_requested{ false };
+
+	void _request_flush_hook();
+	void _connect_process_frame();
+	void _disconnect_process_frame();
+	void _process_frame();
+
 protected:
 	static void _bind_methods();
+	void _notification(int p_what);
 
 public:
-	void count(const String &p_name, int64_t p_value = 1, const Dictionary &p_attributes = Dictionary());
-	void gauge(const String &p_name, double p_value, const String &p_unit = String(), const Dictionary &p_attributes = Dictionary());
-	void distribution(const String &p_name, double p_value, const String &p_unit = String(), const Dictionary &p_attributes = Dictionary());
+	// Attributes can be a Dictionary or SentryAttributes.
+	void count(const String &p_name, int64_t p_value = 1, const Variant &p_attributes = Dictionary());
+	void gauge(const String &p_name, double p_value, const String &p_unit = String(), const Variant &p_attributes = Dictionary());
+	void distribution(const String &p_name, double p_value, const String &p_unit = String(), const Variant &p_attributes = Dictionary());
+
+	// Returns a timer that records elapsed time as a distribution in milliseconds when stopped.
+	Ref<SentryMetricTimer> start_timer(const String &p_name, const Variant &p_attributes = Dictionary());
+
+	// Sends aggregated metrics now, with the current scope of the calling thread (normally the main thread).
+	void flush();
 
 	SentryMetrics() = default;
 };
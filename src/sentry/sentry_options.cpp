@@ -46,6 +46,7 @@ namespace sentry {
 void SentryLoggerLimits::_bind_methods() {
 	BIND_PROPERTY_SIMPLE(SentryLoggerLimits, Variant::INT, events_per_frame);
 	BIND_PROPERTY_SIMPLE(SentryLoggerLimits, Variant::INT, repeated_error_window_ms);
+	BIND_PROPERTY_SIMPLE(SentryLoggerLimits, Variant::INT, repeated_error_capacity);
 	BIND_PROPERTY_SIMPLE(SentryLoggerLimits, Variant::INT, throttle_events);
 	BIND_PROPERTY_SIMPLE(SentryLoggerLimits, Variant::INT, throttle_window_ms);
 }
@@ -66,6 +67,14 @@ void SentryGodotLoggerOptions::_bind_methods() {
 	BIND_PROPERTY_SIMPLE(SentryGodotLoggerOptions, Variant::INT, event_mask);
 	BIND_PROPERTY_SIMPLE(SentryGodotLoggerOptions, Variant::INT, breadcrumb_mask);
 	BIND_PROPERTY_SIMPLE(SentryGodotLoggerOptions, Variant::INT, log_mask);
+	BIND_PROPERTY_SIMPLE(SentryGodotLoggerOptions, Variant::BOOL, async_capture);
+	BIND_PROPERTY(SentryGodotLoggerOptions, PropertyInfo(Variant::INT, "async_queue_size", PROPERTY_HINT_RANGE, "1,1024"), set_async_queue_size, get_async_queue_size);
+	BIND_PROPERTY(SentryGodotLoggerOptions, PropertyInfo(Variant::INT, "async_overflow_policy", PROPERTY_HINT_ENUM, "Drop Newest,Drop Oldest,Capture Immediately"), set_async_overflow_policy, get_async_overflow_policy);
+	BIND_PROPERTY_SIMPLE(SentryGodotLoggerOptions, Variant::PACKED_STRING_ARRAY, message_filters);
+
+	BIND_ENUM_CONSTANT(OVERFLOW_DROP_NEWEST);
+	BIND_ENUM_CONSTANT(OVERFLOW_DROP_OLDEST);
+	BIND_ENUM_CONSTANT(OVERFLOW_CAPTURE_IMMEDIATELY);
 
 	BIND_PROPERTY_READONLY(SentryGodotLoggerOptions, PropertyInfo(Variant::OBJECT, "limits", PROPERTY_HINT_TYPE_STRING, "SentryLoggerLimits", PROPERTY_USAGE_NONE), get_limits);
 }
@@ -132,12 +141,25 @@ void SentryOptions::_define_project_settings(const Ref<SentryOptions> &p_options
 	_define_setting(PropertyInfo(Variant::INT, "sentry/options/max_breadcrumbs", PROPERTY_HINT_RANGE, "0, 500"), p_options->max_breadcrumbs, false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/options/shutdown_timeout_ms", PROPERTY_HINT_RANGE, "0,30000"), p_options->shutdown_timeout_ms, false);
 	_define_setting("sentry/options/send_default_pii", p_options->send_default_pii);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/contexts/max_array_elements", PROPERTY_HINT_RANGE, "0,100000"), p_options->context_max_array_elements, false);
+	_define_setting("sentry/options/contexts/bytes_as_base64", p_options->context_bytes_as_base64, false);
 
 	_define_setting("sentry/options/attach_log", p_options->attach_log, false);
 	_define_setting("sentry/options/attach_scene_tree", p_options->attach_scene_tree);
+	_define_setting("sentry/options/scene_tree/incremental", p_options->scene_tree_incremental, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/scene_tree/max_nodes", PROPERTY_HINT_RANGE, "0,100000"), p_options->scene_tree_max_nodes, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/scene_tree/max_depth", PROPERTY_HINT_RANGE, "0,1000"), p_options->scene_tree_max_depth, false);
+	_define_setting(PropertyInfo(Variant::DICTIONARY, "sentry/options/scene_tree/collapse_rules", PROPERTY_HINT_DICTIONARY_TYPE, "String;int"), p_options->scene_tree_collapse_rules, false);
 
 	_define_setting("sentry/options/enable_logs", p_options->enable_logs, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/log_batching/interval_ms", PROPERTY_HINT_RANGE, "0,10000,1"), p_options->log_batch_interval_ms, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/log_batching/batch_size", PROPERTY_HINT_RANGE, "1,10000,1"), p_options->log_batch_size, false);
+	_define_setting(PropertyInfo(Variant::DICTIONARY, "sentry/options/log_rate_limits", PROPERTY_HINT_DICTIONARY_TYPE, "String;float"), p_options->log_rate_limits, false);
 	_define_setting("sentry/options/enable_metrics", p_options->enable_metrics, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/metrics_aggregation_interval_ms", PROPERTY_HINT_RANGE, "0,60000,1"), p_options->metrics_aggregation_interval_ms, false);
+	_define_setting("sentry/options/performance_metrics", p_options->performance_metrics, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/frame_hitches/threshold_ms", PROPERTY_HINT_RANGE, "0,10000,1"), p_options->frame_hitch_threshold_ms, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/frame_hitches/severe_threshold_ms", PROPERTY_HINT_RANGE, "0,10000,1"), p_options->frame_severe_hitch_threshold_ms, false);
 
 	_define_setting("sentry/options/app_hang/tracking", p_options->enable_app_hang_tracking, false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/options/app_hang/timeout_ms", PROPERTY_HINT_RANGE, "1000,10000,1"), p_options->app_hang_timeout_ms, false);
@@ -150,10 +172,16 @@ void SentryOptions::_define_project_settings(const Ref<SentryOptions> &p_options
 	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/events", PROPERTY_HINT_FLAGS, sentry::GODOT_ERROR_MASK_EXPORT_STRING_FOR_EVENTS()), logger_options->get_event_mask(), false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/breadcrumbs", PROPERTY_HINT_FLAGS, sentry::GODOT_ERROR_MASK_EXPORT_STRING()), logger_options->get_breadcrumb_mask(), false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/logs", PROPERTY_HINT_FLAGS, sentry::GODOT_ERROR_MASK_EXPORT_STRING()), logger_options->get_log_mask(), false);
+	_define_setting("sentry/godot_logger/async_capture", logger_options->get_async_capture(), false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/async_queue_size", PROPERTY_HINT_RANGE, "1,1024"), logger_options->get_async_queue_size(), false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/async_overflow_policy", PROPERTY_HINT_ENUM, "Drop Newest,Drop Oldest,Capture Immediately"), (int)logger_options->get_async_overflow_policy(), false);
+	_define_setting("sentry/godot_logger/message_filters", logger_options->get_message_filters(), false);
+	_requires_restart("sentry/godot_logger/message_filters");
 
 	Ref<SentryLoggerLimits> limits = logger_options->get_limits();
 	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/limits/events_per_frame", PROPERTY_HINT_RANGE, "0,20"), limits->get_events_per_frame(), false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/limits/repeated_error_window_ms", PROPERTY_HINT_RANGE, "0,10000"), limits->get_repeated_error_window_ms(), false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/limits/repeated_error_capacity", PROPERTY_HINT_RANGE, "1,4096"), limits->get_repeated_error_capacity(), false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/limits/throttle_events", PROPERTY_HINT_RANGE, "0,20"), limits->get_throttle_events(), false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/godot_logger/limits/throttle_window_ms", PROPERTY_HINT_RANGE, "0,10000"), limits->get_throttle_window_ms(), false);
 
@@ -163,6 +191,12 @@ void SentryOptions::_define_project_settings(const Ref<SentryOptions> &p_options
 
 	_define_setting("sentry/experimental/attach_screenshot", p_options->attach_screenshot);
 	_define_setting(sentry::make_level_enum_property("sentry/experimental/screenshot_level"), p_options->screenshot_level, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/experimental/screenshot_format", PROPERTY_HINT_ENUM, "JPEG,PNG,WebP"), (int)p_options->screenshot_format, false);
+	_define_setting(PropertyInfo(Variant::FLOAT, "sentry/experimental/screenshot_quality", PROPERTY_HINT_RANGE, "0.01,1.0,0.01"), p_options->screenshot_quality, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/experimental/screenshot_max_size", PROPERTY_HINT_RANGE, "0,8192,1,suffix:px"), p_options->screenshot_max_size, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/experimental/screenshot_history/frames", PROPERTY_HINT_RANGE, "0,64"), p_options->screenshot_history_frames, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/experimental/screenshot_history/interval", PROPERTY_HINT_RANGE, "1,600,1,suffix:frames"), p_options->screenshot_history_interval, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/experimental/screenshot_history/frame_size", PROPERTY_HINT_RANGE, "16,1920,1,suffix:px"), p_options->screenshot_history_frame_size, false);
 }
 
 void SentryOptions::_load_project_settings(const Ref<SentryOptions> &p_options) {
@@ -224,12 +258,25 @@ void SentryOptions::_load_project_settings(const Ref<SentryOptions> &p_options)
 	p_options->max_breadcrumbs = ProjectSettings::get_singleton()->get_setting("sentry/options/max_breadcrumbs", p_options->max_breadcrumbs);
 	p_options->shutdown_timeout_ms = ProjectSettings::get_singleton()->get_setting("sentry/options/shutdown_timeout_ms", p_options->shutdown_timeout_ms);
 	p_options->send_default_pii = ProjectSettings::get_singleton()->get_setting("sentry/options/send_default_pii", p_options->send_default_pii);
+	p_options->set_context_max_array_elements(ProjectSettings::get_singleton()->get_setting("sentry/options/contexts/max_array_elements", p_options->context_max_array_elements));
+	p_options->context_bytes_as_base64 = ProjectSettings::get_singleton()->get_setting("sentry/options/contexts/bytes_as_base64", p_options->context_bytes_as_base64);
 
 	p_options->attach_log = ProjectSettings::get_singleton()->get_setting("sentry/options/attach_log", p_options->attach_log);
 	p_options->attach_scene_tree = ProjectSettings::get_singleton()->get_setting("sentry/options/attach_scene_tree", p_options->attach_scene_tree);
+	p_options->scene_tree_incremental = ProjectSettings::get_singleton()->get_setting("sentry/options/scene_tree/incremental", p_options->scene_tree_incremental);
+	p_options->scene_tree_max_nodes = ProjectSettings::get_singleton()->get_setting("sentry/options/scene_tree/max_nodes", p_options->scene_tree_max_nodes);
+	p_options->scene_tree_max_depth = ProjectSettings::get_singleton()->get_setting("sentry/options/scene_tree/max_depth", p_options->scene_tree_max_depth);
+	p_options->scene_tree_collapse_rules = ProjectSettings::get_singleton()->get_setting("sentry/options/scene_tree/collapse_rules", p_options->scene_tree_collapse_rules);
 
 	p_options->enable_logs = ProjectSettings::get_singleton()->get_setting("sentry/options/enable_logs", p_options->enable_logs);
+	p_options->log_batch_interval_ms = ProjectSettings::get_singleton()->get_setting("sentry/options/log_batching/interval_ms", p_options->log_batch_interval_ms);
+	p_options->set_log_batch_size(ProjectSettings::get_singleton()->get_setting("sentry/options/log_batching/batch_size", p_options->log_batch_size));
+	p_options->log_rate_limits = ProjectSettings::get_singleton()->get_setting("sentry/options/log_rate_limits", p_options->log_rate_limits);
 	p_options->enable_metrics = ProjectSettings::get_singleton()->get_setting("sentry/options/enable_metrics", p_options->enable_metrics);
+	p_options->metrics_aggregation_interval_ms = ProjectSettings::get_singleton()->get_setting("sentry/options/metrics_aggregation_interval_ms", p_options->metrics_aggregation_interval_ms);
+	p_options->performance_metrics = ProjectSettings::get_singleton()->get_setting("sentry/options/performance_metrics", p_options->performance_metrics);
+	p_options->frame_hitch_threshold_ms = ProjectSettings::get_singleton()->get_setting("sentry/options/frame_hitches/threshold_ms", p_options->frame_hitch_threshold_ms);
+	p_options->frame_severe_hitch_threshold_ms = ProjectSettings::get_singleton()->get_setting("sentry/options/frame_hitches/severe_threshold_ms", p_options->frame_severe_hitch_threshold_ms);
 
 	// Only a disabled setting is worth warning about: the enabled default carries no user intent.
 	if (!p_options->enable_logs) {
@@ -249,10 +296,15 @@ void SentryOptions::_load_project_settings(const Ref<SentryOptions> &p_options)
 	logger_options->set_event_mask((int)ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/events", logger_options->get_event_mask()));
 	logger_options->set_breadcrumb_mask((int)ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/breadcrumbs", logger_options->get_breadcrumb_mask()));
 	logger_options->set_log_mask((int)ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/logs", logger_options->get_log_mask()));
+	logger_options->set_async_capture(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/async_capture", logger_options->get_async_capture()));
+	logger_options->set_async_queue_size(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/async_queue_size", logger_options->get_async_queue_size()));
+	logger_options->set_async_overflow_policy((SentryGodotLoggerOptions::AsyncOverflowPolicy)(int)ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/async_overflow_policy", (int)logger_options->get_async_overflow_policy()));
+	logger_options->set_message_filters(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/message_filters", logger_options->get_message_filters()));
 
 	Ref<SentryLoggerLimits> limits = logger_options->get_limits();
 	limits->set_events_per_frame(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/limits/events_per_frame", limits->get_events_per_frame()));
 	limits->set_repeated_error_window_ms(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/limits/repeated_error_window_ms", limits->get_repeated_error_window_ms()));
+	limits->set_repeated_error_capacity(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/limits/repeated_error_capacity", limits->get_repeated_error_capacity()));
 	limits->set_throttle_events(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/limits/throttle_events", limits->get_throttle_events()));
 	limits->set_throttle_window_ms(ProjectSettings::get_singleton()->get_setting("sentry/godot_logger/limits/throttle_window_ms", limits->get_throttle_window_ms()));
 
@@ -271,6 +323,12 @@ void SentryOptions::_load_project_settings(const Ref<SentryOptions> &p_options)
 
 	p_options->attach_screenshot = ProjectSettings::get_singleton()->get_setting("sentry/experimental/attach_screenshot", p_options->attach_screenshot);
 	p_options->screenshot_level = (sentry::Level)(int)ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_level", p_options->screenshot_level);
+	p_options->set_screenshot_format((ScreenshotFormat)(int)ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_format", (int)p_options->screenshot_format));
+	p_options->set_screenshot_quality(ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_quality", p_options->screenshot_quality));
+	p_options->set_screenshot_max_size(ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_max_size", p_options->screenshot_max_size));
+	p_options->set_screenshot_history_frames(ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_history/frames", p_options->screenshot_history_frames));
+	p_options->set_screenshot_history_interval(ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_history/interval", p_options->screenshot_history_interval));
+	p_options->set_screenshot_history_frame_size(ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_history/frame_size", p_options->screenshot_history_frame_size));
 }
 
 void SentryOptions::_init_debug_option(DebugMode p_mode) {
@@ -419,14 +477,33 @@ void SentryOptions::_bind_methods() {
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "max_breadcrumbs"), set_max_breadcrumbs, get_max_breadcrumbs);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "shutdown_timeout_ms", PROPERTY_HINT_RANGE, "0,30000"), set_shutdown_timeout_ms, get_shutdown_timeout_ms);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "send_default_pii"), set_send_default_pii, is_send_default_pii_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "context_max_array_elements", PROPERTY_HINT_RANGE, "0,100000"), set_context_max_array_elements, get_context_max_array_elements);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "context_bytes_as_base64"), set_context_bytes_as_base64, is_context_bytes_as_base64_enabled);
 
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "attach_log"), set_attach_log, is_attach_log_enabled);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "attach_screenshot"), set_attach_screenshot, is_attach_screenshot_enabled);
 	BIND_PROPERTY(SentryOptions, sentry::make_level_enum_property("screenshot_level"), set_screenshot_level, get_screenshot_level);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "screenshot_format", PROPERTY_HINT_ENUM, "JPEG,PNG,WebP"), set_screenshot_format, get_screenshot_format);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::FLOAT, "screenshot_quality", PROPERTY_HINT_RANGE, "0.01,1.0,0.01"), set_screenshot_quality, get_screenshot_quality);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "screenshot_max_size", PROPERTY_HINT_RANGE, "0,8192,1,suffix:px"), set_screenshot_max_size, get_screenshot_max_size);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "screenshot_history_frames", PROPERTY_HINT_RANGE, "0,64"), set_screenshot_history_frames, get_screenshot_history_frames);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "screenshot_history_interval", PROPERTY_HINT_RANGE, "1,600,1,suffix:frames"), set_screenshot_history_interval, get_screenshot_history_interval);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "screenshot_history_frame_size", PROPERTY_HINT_RANGE, "16,1920,1,suffix:px"), set_screenshot_history_frame_size, get_screenshot_history_frame_size);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "attach_scene_tree"), set_attach_scene_tree, is_attach_scene_tree_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "scene_tree_incremental"), set_scene_tree_incremental, is_scene_tree_incremental_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "scene_tree_max_nodes", PROPERTY_HINT_RANGE, "0,100000"), set_scene_tree_max_nodes, get_scene_tree_max_nodes);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "scene_tree_max_depth", PROPERTY_HINT_RANGE, "0,1000"), set_scene_tree_max_depth, get_scene_tree_max_depth);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::DICTIONARY, "scene_tree_collapse_rules", PROPERTY_HINT_DICTIONARY_TYPE, "String;int"), set_scene_tree_collapse_rules, get_scene_tree_collapse_rules);
 
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::CALLABLE, "before_send_log"), set_before_send_log, get_before_send_log);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "log_batch_interval_ms", PROPERTY_HINT_RANGE, "0,10000,1"), set_log_batch_interval_ms, get_log_batch_interval_ms);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "log_batch_size", PROPERTY_HINT_RANGE, "1,10000,1"), set_log_batch_size, get_log_batch_size);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::DICTIONARY, "log_rate_limits", PROPERTY_HINT_DICTIONARY_TYPE, "String;float"), set_log_rate_limits, get_log_rate_limits);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::CALLABLE, "before_send_metric"), set_before_send_metric, get_before_send_metric);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "metrics_aggregation_interval_ms", PROPERTY_HINT_RANGE, "0,60000,1"), set_metrics_aggregation_interval_ms, get_metrics_aggregation_interval_ms);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "performance_metrics"), set_performance_metrics, is_performance_metrics_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "frame_hitch_threshold_ms", PROPERTY_HINT_RANGE, "0,10000,1"), set_frame_hitch_threshold_ms, get_frame_hitch_threshold_ms);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "frame_severe_hitch_threshold_ms", PROPERTY_HINT_RANGE, "0,10000,1"), set_frame_severe_hitch_threshold_ms, get_frame_severe_hitch_threshold_ms);
 
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "enable_app_hang_tracking"), set_app_hang_tracking_enabled, is_app_hang_tracking_enabled);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "app_hang_timeout_ms", PROPERTY_HINT_RANGE, "1000,10000,1"), set_app_hang_timeout_ms, get_app_hang_timeout_ms);
@@ -439,6 +516,10 @@ void SentryOptions::_bind_methods() {
 	BIND_PROPERTY_READONLY(SentryOptions, PropertyInfo(Variant::OBJECT, "android", PROPERTY_HINT_TYPE_STRING, "SentryAndroidOptions", PROPERTY_USAGE_NONE), get_android);
 	BIND_PROPERTY_READONLY(SentryOptions, PropertyInfo(Variant::OBJECT, "godot_logger", PROPERTY_HINT_TYPE_STRING, "SentryGodotLoggerOptions", PROPERTY_USAGE_NONE), get_godot_logger);
 
+	BIND_ENUM_CONSTANT(SCREENSHOT_FORMAT_JPEG);
+	BIND_ENUM_CONSTANT(SCREENSHOT_FORMAT_PNG);
+	BIND_ENUM_CONSTANT(SCREENSHOT_FORMAT_WEBP);
+
 	{
 		using namespace sentry;
 		BIND_BITFIELD_FLAG(MASK_NONE);
@@ -24,6 +24,9 @@ class SentryLoggerLimits : public RefCounted {
 	// Limit to 1 error captured per source line within T milliseconds window.
 	SIMPLE_PROPERTY(int, repeated_error_window_ms, 1000);
 
+	// Number of distinct error sources tracked for the repeated error window.
+	SIMPLE_PROPERTY(int, repeated_error_capacity, 256);
+
 	// Limit to N events within T milliseconds window.
 	SIMPLE_PROPERTY(int, throttle_events, 20);
 	SIMPLE_PROPERTY(int, throttle_window_ms, 10000);
@@ -36,6 +39,14 @@ protected:
 class SentryGodotLoggerOptions : public RefCounted {
 	GDCLASS(SentryGodotLoggerOptions, RefCounted);
 
+public:
+	// What to do with an error when the asynchronous capture queue is full.
+	enum AsyncOverflowPolicy {
+		OVERFLOW_DROP_NEWEST,
+		OVERFLOW_DROP_OLDEST,
+		OVERFLOW_CAPTURE_IMMEDIATELY,
+	};
+
 	SIMPLE_PROPERTY(bool, enabled, true);
 	SIMPLE_PROPERTY(bool, include_source_context, true);
 	SIMPLE_PROPERTY(bool, include_variables, false);
@@ -43,6 +54,14 @@ class SentryGodotLoggerOptions : public RefCounted {
 	SIMPLE_PROPERTY(BitField<GodotLoggerEventMask>, breadcrumb_mask, GodotLoggerEventMask::MASK_ALL);
 	SIMPLE_PROPERTY(BitField<GodotLoggerEventMask>, log_mask, GodotLoggerEventMask::MASK_NONE);
 
+	// Hand captured errors over to a worker thread instead of processing them on the thread that logged them.
+	SIMPLE_PROPERTY(bool, async_capture, false);
+	SIMPLE_PROPERTY(int, async_queue_size, 64);
+	SIMPLE_PROPERTY(AsyncOverflowPolicy, async_overflow_policy, OVERFLOW_DROP_NEWEST);
+
+	// Messages matching any of these patterns are not captured as breadcrumbs or logs.
+	SIMPLE_PROPERTY(PackedStringArray, message_filters, PackedStringArray());
+
 private:
 	Ref<SentryLoggerLimits> limits;
 
@@ -96,6 +115,12 @@ public:
 	using GodotErrorType = sentry::GodotErrorType;
 	using GodotLoggerEventMask = sentry::GodotLoggerEventMask;
 
+	enum ScreenshotFormat {
+		SCREENSHOT_FORMAT_JPEG,
+		SCREENSHOT_FORMAT_PNG,
+		SCREENSHOT_FORMAT_WEBP,
+	};
+
 private:
 	enum class DebugMode {
 		DEBUG_OFF = 0,
@@ -116,17 +141,36 @@ private:
 	int max_breadcrumbs = 100;
 	int shutdown_timeout_ms = 2000;
 	bool send_default_pii = false;
+	int context_max_array_elements = 0;
+	bool context_bytes_as_base64 = false;
 
 	bool attach_log = true;
 	bool attach_screenshot = false;
 	sentry::Level screenshot_level = sentry::LEVEL_FATAL;
+	ScreenshotFormat screenshot_format = SCREENSHOT_FORMAT_JPEG;
+	float screenshot_quality = 0.75;
+	int screenshot_max_size = 0;
+	int screenshot_history_frames = 0;
+	int screenshot_history_interval = 10;
+	int screenshot_history_frame_size = 320;
 	bool attach_scene_tree = false;
+	bool scene_tree_incremental = false;
+	int scene_tree_max_nodes = 0;
+	int scene_tree_max_depth = 0;
+	Dictionary scene_tree_collapse_rules;
 
 	bool enable_logs = true;
+	int log_batch_interval_ms = 0;
+	int log_batch_size = 100;
+	Dictionary log_rate_limits;
 	Callable before_send_log;
 
 	bool enable_metrics = true;
+	int metrics_aggregation_interval_ms = 0;
 	Callable before_send_metric;
+	bool performance_metrics = false;
+	int frame_hitch_threshold_ms = 100;
+	int frame_severe_hitch_threshold_ms = 500;
 
 	bool enable_app_hang_tracking = true;
 	int app_hang_timeout_ms = 5000;
@@ -193,6 +237,12 @@ public:
 	_FORCE_INLINE_ bool is_send_default_pii_enabled() const { return send_default_pii; }
 	_FORCE_INLINE_ void set_send_default_pii(bool p_enabled) { send_default_pii = p_enabled; }
 
+	_FORCE_INLINE_ int get_context_max_array_elements() const { return context_max_array_elements; }
+	_FORCE_INLINE_ void set_context_max_array_elements(int p_max) { context_max_array_elements = MAX(0, p_max); }
+
+	_FORCE_INLINE_ bool is_context_bytes_as_base64_enabled() const { return context_bytes_as_base64; }
+	_FORCE_INLINE_ void set_context_bytes_as_base64(bool p_enabled) { context_bytes_as_base64 = p_enabled; }
+
 	_FORCE_INLINE_ bool is_attach_log_enabled() const { return attach_log; }
 	_FORCE_INLINE_ void set_attach_log(bool p_enabled) { attach_log = p_enabled; }
 
@@ -202,21 +252,72 @@ public:
 	_FORCE_INLINE_ sentry::Level get_screenshot_level() const { return screenshot_level; }
 	_FORCE_INLINE_ void set_screenshot_level(sentry::Level p_level) { screenshot_level = p_level; }
 
+	_FORCE_INLINE_ ScreenshotFormat get_screenshot_format() const { return screenshot_format; }
+	_FORCE_INLINE_ void set_screenshot_format(ScreenshotFormat p_format) { screenshot_format = p_format; }
+
+	_FORCE_INLINE_ float get_screenshot_quality() const { return screenshot_quality; }
+	_FORCE_INLINE_ void set_screenshot_quality(float p_quality) { screenshot_quality = CLAMP(p_quality, 0.01f, 1.0f); }
+
+	_FORCE_INLINE_ int get_screenshot_max_size() const { return screenshot_max_size; }
+	_FORCE_INLINE_ void set_screenshot_max_size(int p_max_size) { screenshot_max_size = MAX(0, p_max_size); }
+
+	_FORCE_INLINE_ int get_screenshot_history_frames() const { return screenshot_history_frames; }
+	_FORCE_INLINE_ void set_screenshot_history_frames(int p_frames) { screenshot_history_frames = CLAMP(p_frames, 0, 64); }
+
+	_FORCE_INLINE_ int get_screenshot_history_interval() const { return screenshot_history_interval; }
+	_FORCE_INLINE_ void set_screenshot_history_interval(int p_interval) { screenshot_history_interval = MAX(1, p_interval); }
+
+	_FORCE_INLINE_ int get_screenshot_history_frame_size() const { return screenshot_history_frame_size; }
+	_FORCE_INLINE_ void set_screenshot_history_frame_size(int p_size) { screenshot_history_frame_size = CLAMP(p_size, 16, 1920); }
+
 	_FORCE_INLINE_ void set_attach_scene_tree(bool p_enable) { attach_scene_tree = p_enable; }
 	_FORCE_INLINE_ bool is_attach_scene_tree_enabled() const { return attach_scene_tree; }
 
+	_FORCE_INLINE_ void set_scene_tree_incremental(bool p_enable) { scene_tree_incremental = p_enable; }
+	_FORCE_INLINE_ bool is_scene_tree_incremental_enabled() const { return scene_tree_incremental; }
+
+	_FORCE_INLINE_ void set_scene_tree_max_nodes(int p_max_nodes) { scene_tree_max_nodes = p_max_nodes; }
+	_FORCE_INLINE_ int get_scene_tree_max_nodes() const { return scene_tree_max_nodes; }
+
+	_FORCE_INLINE_ void set_scene_tree_max_depth(int p_max_depth) { scene_tree_max_depth = p_max_depth; }
+	_FORCE_INLINE_ int get_scene_tree_max_depth() const { return scene_tree_max_depth; }
+
+	_FORCE_INLINE_ void set_scene_tree_collapse_rules(const Dictionary &p_rules) { scene_tree_collapse_rules = p_rules; }
+	_FORCE_INLINE_ Dictionary get_scene_tree_collapse_rules() const { return scene_tree_collapse_rules; }
+
 	_FORCE_INLINE_ bool get_enable_logs() const { return enable_logs; }
 	_FORCE_INLINE_ void set_enable_logs(bool p_enabled) { enable_logs = p_enabled; }
 
+	_FORCE_INLINE_ int get_log_batch_interval_ms() const { return log_batch_interval_ms; }
+	_FORCE_INLINE_ void set_log_batch_interval_ms(int p_milliseconds) { log_batch_interval_ms = p_milliseconds; }
+
+	_FORCE_INLINE_ int get_log_batch_size() const { return log_batch_size; }
+	_FORCE_INLINE_ void set_log_batch_size(int p_size) { log_batch_size = MAX(1, p_size); }
+
+	_FORCE_INLINE_ Dictionary get_log_rate_limits() const { return log_rate_limits; }
+	_FORCE_INLINE_ void set_log_rate_limits(const Dictionary &p_limits) { log_rate_limits = p_limits; }
+
 	_FORCE_INLINE_ Callable get_before_send_log() const { return before_send_log; }
 	_FORCE_INLINE_ void set_before_send_log(const Callable &p_callback) { before_send_log = p_callback; }
 
 	_FORCE_INLINE_ bool get_enable_metrics() const { return enable_metrics; }
 	_FORCE_INLINE_ void set_enable_metrics(bool p_enabled) { enable_metrics = p_enabled; }
 
+	_FORCE_INLINE_ int get_metrics_aggregation_interval_ms() const { return metrics_aggregation_interval_ms; }
+	_FORCE_INLINE_ void set_metrics_aggregation_interval_ms(int p_milliseconds) { metrics_aggregation_interval_ms = p_milliseconds; }
+
 	_FORCE_INLINE_ Callable get_before_send_metric() const { return before_send_metric; }
 	_FORCE_INLINE_ void set_before_send_metric(const Callable &p_callback) { before_send_metric = p_callback; }
 
+	_FORCE_INLINE_ bool is_performance_metrics_enabled() const { return performance_metrics; }
+	_FORCE_INLINE_ void set_performance_metrics(bool p_enabled) { performance_metrics = p_enabled; }
+
+	_FORCE_INLINE_ int get_frame_hitch_threshold_ms() const { return frame_hitch_threshold_ms; }
+	_FORCE_INLINE_ void set_frame_hitch_threshold_ms(int p_milliseconds) { frame_hitch_threshold_ms = p_milliseconds; }
+
+	_FORCE_INLINE_ int get_frame_severe_hitch_threshold_ms() const { return frame_severe_hitch_threshold_ms; }
+	_FORCE_INLINE_ void set_frame_severe_hitch_threshold_ms(int p_milliseconds) { frame_severe_hitch_threshold_ms = p_milliseconds; }
+
 	_FORCE_INLINE_ bool is_app_hang_tracking_enabled() const { return enable_app_hang_tracking; }
 	_FORCE_INLINE_ void set_app_hang_tracking_enabled(bool p_enabled) { enable_app_hang_tracking = p_enabled; }
 
@@ -304,4 +405,6 @@ public:
 
 } // namespace sentry
 
+VARIANT_ENUM_CAST(sentry::SentryGodotLoggerOptions::AsyncOverflowPolicy);
+VARIANT_ENUM_CAST(sentry::SentryOptions::ScreenshotFormat);
 VARIANT_BITFIELD_CAST(sentry::SentryOptions::GodotLoggerEventMask);
@@ -14,6 +14,7 @@
 #include "sentry/sentry_attachment.h"
 #include "sentry/sentry_options.h"
 #include "sentry/util/library_path.h"
+#include "sentry/util/screenshot.h"
 #include "sentry/util/simple_bind.h"
 #include "sentry/uuid.h"
 
@@ -243,6 +244,8 @@ void SentrySDK::init(const Callable &p_configuration_callback) {
 			_init_contexts();
 		}
 
+		logger->configure_rate_limits(options->get_log_rate_limits());
+
 		if (options->get_godot_logger()->get_enabled()) {
 			if (godot_logger.is_null()) {
 				godot_logger.instantiate();
@@ -268,6 +271,8 @@ void SentrySDK::close() {
 			OS::get_singleton()->remove_logger(godot_logger);
 			godot_logger.unref();
 		}
+		logger->flush();
+		metrics->flush();
 		internal_sdk->close();
 		_invalidate_scopes();
 	}
@@ -384,6 +389,7 @@ void SentrySDK::_init_contexts() {
 
 	// Mark Godot engine singletons as safe to access.
 	sentry::engine_lifecycle::mark_engine_singletons_as_ready();
+	sentry::contexts::invalidate_event_contexts();
 
 #if defined(SDK_NATIVE) || defined(SDK_JAVASCRIPT)
 	internal_sdk->set_context("device", sentry::contexts::make_device_context(runtime_config));
@@ -436,9 +442,20 @@ Vector<Ref<SentryAttachment>> SentrySDK::_get_default_attachments() {
 
 	// Attach screenshot.
 	if (options->is_attach_screenshot_enabled()) {
-		String screenshot_path = OS::get_singleton()->get_user_data_dir().path_join(SENTRY_SCREENSHOT_FN);
+		SentryOptions::ScreenshotFormat format = options->get_screenshot_format();
+		String screenshot_path = OS::get_singleton()->get_user_data_dir().path_join(sentry::util::get_screenshot_file_name(format));
 		DirAccess::remove_absolute(screenshot_path);
-		attachments.append(SentryAttachment::create_with_path(screenshot_path));
+		Ref<SentryAttachment> att = SentryAttachment::create_with_path(screenshot_path);
+		att->set_content_type(sentry::util::get_screenshot_content_type(format));
+		attachments.append(att);
+
+		if (options->get_screenshot_history_frames() > 0) {
+			String history_path = OS::get_singleton()->get_user_data_dir().path_join(SENTRY_FRAME_HISTORY_FN);
+			DirAccess::remove_absolute(history_path);
+			Ref<SentryAttachment> history_att = SentryAttachment::create_with_path(history_path);
+			history_att->set_content_type("image/jpeg");
+			attachments.append(history_att);
+		}
 	}
 
 	// Attach view hierarchy (aka scene tree info).
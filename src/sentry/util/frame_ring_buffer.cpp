@@ -0,0 +1,116 @@
+#include "frame_ring_buffer.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace sentry::util {
+
+void FrameRingBuffer::init(int p_capacity, int p_max_size) {
+	max_size = MAX(1, p_max_size);
+	// Worst case is a square source, which is downscaled to max_size x max_size.
+	size_t max_frame_bytes = size_t(max_size) * max_size * 3;
+	capacity = int(MIN(size_t(MAX(0, p_capacity)), MAX_TOTAL_BYTES / max_frame_bytes));
+	source_width = 0;
+	source_height = 0;
+	frame_width = 0;
+	frame_height = 0;
+	storage.clear();
+	storage.shrink_to_fit();
+	clear();
+}
+
+void FrameRingBuffer::clear() {
+	head = 0;
+	count = 0;
+}
+
+Vector2i FrameRingBuffer::get_frame_size_for(int p_source_width, int p_source_height) const {
+	int longest = MAX(p_source_width, p_source_height);
+	double scale = longest > max_size ? double(max_size) / longest : 1.0;
+	return Vector2i(MAX(1, int(p_source_width * scale)), MAX(1, int(p_source_height * scale)));
+}
+
+void FrameRingBuffer::_resize_frames(int p_source_width, int p_source_height) {
+	source_width = p_source_width;
+	source_height = p_source_height;
+
+	Vector2i frame_size = get_frame_size_for(p_source_width, p_source_height);
+	frame_width = frame_size.x;
+	frame_height = frame_size.y;
+
+	storage.resize(_get_frame_bytes() * capacity);
+	clear();
+}
+
+void FrameRingBuffer::push(const Ref<Image> &p_image) {
+	ERR_FAIL_COND(p_image.is_null() || p_image->is_empty());
+	if (capacity == 0) {
+		return;
+	}
+
+	Ref<Image> image = p_image;
+	Image::Format format = image->get_format();
+	if (format != Image::FORMAT_RGB8 && format != Image::FORMAT_RGBA8) {
+		// Unusual for viewport textures, so the conversion cost is acceptable.
+		image = image->duplicate();
+		image->convert(Image::FORMAT_RGB8);
+		format = Image::FORMAT_RGB8;
+	}
+
+	int src_width = image->get_width();
+	int src_height = image->get_height();
+	if (src_width != source_width || src_height != source_height) {
+		_resize_frames(src_width, src_height);
+	}
+
+	const int src_bpp = format == Image::FORMAT_RGBA8 ? 4 : 3;
+	const PackedByteArray src_data = image->get_data();
+	const uint8_t *src = src_data.ptr();
+	uint8_t *dst = storage.data() + _get_frame_bytes() * head;
+
+	// Nearest-neighbor sampling: cheap enough to run on the main thread, and the result is only a preview.
+	for (int y = 0; y < frame_height; y++) {
+		const uint8_t *src_row = src + size_t(int64_t(y) * src_height / frame_height) * src_width * src_bpp;
+		for (int x = 0; x < frame_width; x++) {
+			const uint8_t *pixel = src_row + size_t(int64_t(x) * src_width / frame_width) * src_bpp;
+			*(dst++) = pixel[0];
+			*(dst++) = pixel[1];
+			*(dst++) = pixel[2];
+		}
+	}
+
+	head = (head + 1) % capacity;
+	count = MIN(count + 1, capacity);
+}
+
+Ref<Image> FrameRingBuffer::make_contact_sheet() const {
+	if (count == 0) {
+		return Ref<Image>();
+	}
+
+	const int columns = int(std::ceil(std::sqrt(double(count))));
+	const int rows = (count + columns - 1) / columns;
+	const int sheet_width = columns * frame_width;
+	const int sheet_height = rows * frame_height;
+	const size_t frame_bytes = _get_frame_bytes();
+	const size_t frame_row_bytes = size_t(frame_width) * 3;
+	const size_t sheet_row_bytes = size_t(sheet_width) * 3;
+
+	PackedByteArray sheet;
+	sheet.resize(sheet_row_bytes * sheet_height);
+	uint8_t *out = sheet.ptrw();
+	memset(out, 0, sheet.size());
+
+	const int oldest = (head - count + capacity) % capacity;
+	for (int i = 0; i < count; i++) {
+		const uint8_t *frame = storage.data() + frame_bytes * ((oldest + i) % capacity);
+		uint8_t *cell = out + (i / columns) * frame_height * sheet_row_bytes + (i % columns) * frame_row_bytes;
+		for (int y = 0; y < frame_height; y++) {
+			memcpy(cell + y * sheet_row_bytes, frame + y * frame_row_bytes, frame_row_bytes);
+		}
+	}
+
+	return Image::create_from_data(sheet_width, sheet_height, false, Image::FORMAT_RGB8, sheet);
+}
+
+} //namespace sentry::util
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <godot_cpp/classes/image.hpp>
+#include <vector>
+
+namespace sentry::util {
+
+using namespace godot;
+
+// Keeps the last N frames downscaled to RGB8 in a single preallocated block of memory.
+// Storage is only reallocated when the source resolution changes.
+// Not thread-safe.
+class FrameRingBuffer {
+public:
+	// Upper bound on the preallocated storage; init() reduces the capacity to stay within it.
+	static constexpr size_t MAX_TOTAL_BYTES = 32 * 1024 * 1024;
+
+private:
+	int capacity = 0;
+	int max_size = 0;
+
+	int source_width = 0;
+	int source_height = 0;
+	int frame_width = 0;
+	int frame_height = 0;
+
+	int head = 0; // slot to write next
+	int count = 0;
+	std::vector<uint8_t> storage;
+
+	size_t _get_frame_bytes() const { return size_t(frame_width) * frame_height * 3; }
+	void _resize_frames(int p_source_width, int p_source_height);
+
+public:
+	// Configures the buffer to hold p_capacity frames, each at most p_max_size pixels on the longest side.
+	// Capacity is reduced if the frames could exceed MAX_TOTAL_BYTES.
+	void init(int p_capacity, int p_max_size);
+	void clear();
+
+	// Returns the size of stored frames for a source of the given size.
+	Vector2i get_frame_size_for(int p_source_width, int p_source_height) const;
+
+	// Downscales the image into the oldest slot. Images already at frame size are copied as is.
+	void push(const Ref<Image> &p_image);
+
+	// Composes stored frames, oldest first, row by row into a single grid image.
+	Ref<Image> make_contact_sheet() const;
+
+	int get_count() const { return count; }
+	int get_capacity() const { return capacity; }
+	int get_frame_width() const { return frame_width; }
+	int get_frame_height() const { return frame_height; }
+};
+
+} //namespace sentry::util
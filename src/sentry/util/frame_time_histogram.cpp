@@ -0,0 +1,87 @@
+#include "frame_time_histogram.h"
+
+namespace {
+
+inline int _highest_bit(uint64_t p_value) {
+	int bit = 0;
+	while (p_value >>= 1) {
+		bit++;
+	}
+	return bit;
+}
+
+} // unnamed namespace
+
+namespace sentry::util {
+
+int FrameTimeHistogram::get_bucket_index(uint64_t p_value_usec) {
+	if (p_value_usec > MAX_VALUE_USEC) {
+		p_value_usec = MAX_VALUE_USEC;
+	}
+	if (p_value_usec < SUB_BUCKET_COUNT) {
+		return int(p_value_usec);
+	}
+	// Keep the top (SUB_BUCKET_BITS - 1) bits below the leading one as the sub-bucket.
+	int shift = _highest_bit(p_value_usec) - (SUB_BUCKET_BITS - 1);
+	return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF + int(p_value_usec >> shift) - SUB_BUCKET_HALF;
+}
+
+uint64_t FrameTimeHistogram::get_bucket_lower_bound(int p_index) {
+	if (p_index < SUB_BUCKET_COUNT) {
+		return uint64_t(p_index);
+	}
+	int offset = p_index - SUB_BUCKET_COUNT;
+	int shift = offset / SUB_BUCKET_HALF + 1;
+	return uint64_t(offset % SUB_BUCKET_HALF + SUB_BUCKET_HALF) << shift;
+}
+
+uint64_t FrameTimeHistogram::get_bucket_upper_bound(int p_index) {
+	if (p_index < SUB_BUCKET_COUNT) {
+		return uint64_t(p_index) + 1;
+	}
+	int offset = p_index - SUB_BUCKET_COUNT;
+	int shift = offset / SUB_BUCKET_HALF + 1;
+	return uint64_t(offset % SUB_BUCKET_HALF + SUB_BUCKET_HALF + 1) << shift;
+}
+
+void FrameTimeHistogram::record(uint64_t p_value_usec) {
+	buckets[get_bucket_index(p_value_usec)].fetch_add(1, std::memory_order_relaxed);
+	total.fetch_add(1, std::memory_order_relaxed);
+	if (p_value_usec > max_value.load(std::memory_order_relaxed)) {
+		max_value.store(p_value_usec, std::memory_order_relaxed);
+	}
+}
+
+void FrameTimeHistogram::reset() {
+	for (std::atomic<uint32_t> &bucket : buckets) {
+		bucket.store(0, std::memory_order_relaxed);
+	}
+	total.store(0, std::memory_order_relaxed);
+	max_value.store(0, std::memory_order_relaxed);
+}
+
+double FrameTimeHistogram::get_value_at_percentile(double p_percentile) const {
+	uint32_t count = get_count();
+	if (count == 0) {
+		return 0.0;
+	}
+
+	double fraction = p_percentile < 0.0 ? 0.0 : (p_percentile > 100.0 ? 1.0 : p_percentile / 100.0);
+	uint64_t rank = uint64_t(fraction * count + 0.5);
+	rank = rank < 1 ? 1 : (rank > count ? count : rank);
+
+	double max = double(get_max());
+	uint64_t cumulative = 0;
+	for (int i = 0; i < BUCKET_COUNT; i++) {
+		cumulative += buckets[i].load(std::memory_order_relaxed);
+		if (cumulative >= rank) {
+			// Middle of the bucket, but never above the largest recorded value.
+			double value = (get_bucket_lower_bound(i) + get_bucket_upper_bound(i) - 1) * 0.5;
+			return value < max ? value : max;
+		}
+	}
+	// Counts may be updated while reading.
+	return max;
+}
+
+} //namespace sentry::util
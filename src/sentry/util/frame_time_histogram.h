@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace sentry::util {
+
+// Histogram of frame durations in microseconds with log-linear buckets, similar to HdrHistogram:
+// each power-of-two range is split into 16 linear sub-buckets, so estimates stay within ~3% of recorded values.
+// Covers 1 µs to ~67 s in constant memory; longer durations are counted in the last bucket.
+// Lock-free: meant for a single writer thread, while other threads may read approximate results.
+class FrameTimeHistogram {
+public:
+	static constexpr int SUB_BUCKET_BITS = 5;
+	static constexpr int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static constexpr int SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+	static constexpr int MAX_VALUE_BITS = 26;
+	static constexpr uint64_t MAX_VALUE_USEC = (uint64_t(1) << MAX_VALUE_BITS) - 1;
+	static constexpr int BUCKET_COUNT = SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_HALF;
+
+private:
+	std::array<std::atomic<uint32_t>, BUCKET_COUNT> buckets{};
+	std::atomic<uint32_t> total{ 0 };
+	std::atomic<uint64_t> max_value{ 0 };
+
+public:
+	static int get_bucket_index(uint64_t p_value_usec);
+	static uint64_t get_bucket_lower_bound(int p_index);
+	static uint64_t get_bucket_upper_bound(int p_index);
+
+	// Writer thread only.
+	void record(uint64_t p_value_usec);
+	void reset();
+
+	uint32_t get_count() const { return total.load(std::memory_order_relaxed); }
+	uint64_t get_max() const { return max_value.load(std::memory_order_relaxed); }
+
+	// Returns the estimated value at the given percentile (0..100) in microseconds, or 0 if empty.
+	double get_value_at_percentile(double p_percentile) const;
+};
+
+} //namespace sentry::util
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <godot_cpp/core/defs.hpp>
 #include <string_view>
 
@@ -21,6 +22,30 @@ _FORCE_INLINE_ size_t fnv1a_hash(const char *p_data, size_t p_len) {
 	return hash;
 }
 
+// 64-bit FNV-1a hash over UTF-32 code units. Hashes Godot String data in place, without
+// converting it to UTF-8 first. Pass the result as p_hash to continue hashing more data.
+constexpr uint64_t FNV64_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV64_PRIME = 1099511628211ULL;
+
+_FORCE_INLINE_ uint64_t fnv1a_hash64(const char32_t *p_data, size_t p_len, uint64_t p_hash = FNV64_OFFSET_BASIS) {
+	for (size_t i = 0; i < p_len; i++) {
+		uint32_t c = static_cast<uint32_t>(p_data[i]);
+		// Feed code unit byte by byte for proper FNV-1a dispersion.
+		p_hash = (p_hash ^ (c & 0xFF)) * FNV64_PRIME;
+		p_hash = (p_hash ^ ((c >> 8) & 0xFF)) * FNV64_PRIME;
+		p_hash = (p_hash ^ ((c >> 16) & 0xFF)) * FNV64_PRIME;
+		p_hash = (p_hash ^ (c >> 24)) * FNV64_PRIME;
+	}
+	return p_hash;
+}
+
+_FORCE_INLINE_ uint64_t fnv1a_hash64(uint64_t p_value, uint64_t p_hash = FNV64_OFFSET_BASIS) {
+	for (int i = 0; i < 8; i++) {
+		p_hash = (p_hash ^ ((p_value >> (i * 8)) & 0xFF)) * FNV64_PRIME;
+	}
+	return p_hash;
+}
+
 _FORCE_INLINE_ size_t hash(const std::string_view &p_value) {
 	return fnv1a_hash(p_value.data(), p_value.size());
 }
@@ -0,0 +1,337 @@
+#include "json_writer.h"
+
+#include "sentry/common_defs.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// Floating-point std::to_chars is unavailable with older Apple deployment targets and libstdc++ before GCC 11.
+#if defined(__APPLE__) || (defined(__GLIBCXX__) && !defined(__cpp_lib_to_chars))
+#define SENTRY_JSON_NO_FLOAT_TO_CHARS
+#endif
+
+namespace {
+
+// For each ASCII character: 0 if no escaping is needed, 'u' for \u00XX, otherwise the character following the backslash.
+constexpr char _escape_table[128] = {
+	'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'b', 't', 'n', 'u', 'f', 'r', 'u', 'u', // 0x00
+	'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', // 0x10
+	0, 0, '"', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x20
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x30
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x40
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\\', 0, 0, 0, // 0x50
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x60
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x70
+};
+
+// Writes ASCII character with JSON escaping, returns the new write position (at most 6 bytes written).
+_FORCE_INLINE_ char *_write_ascii(char *p_out, uint8_t p_char) {
+	char escape = _escape_table[p_char];
+	if (likely(escape == 0)) {
+		*(p_out++) = char(p_char);
+	} else if (escape != 'u') {
+		*(p_out++) = '\\';
+		*(p_out++) = escape;
+	} else {
+		static constexpr char HEX[] = "0123456789abcdef";
+		memcpy(p_out, "\\u00", 4);
+		p_out[4] = HEX[p_char >> 4];
+		p_out[5] = HEX[p_char & 0xF];
+		p_out += 6;
+	}
+	return p_out;
+}
+
+// Enough for any formatted number, including the shortest round-trip double representation (at most 24).
+constexpr size_t MAX_NUMBER_LENGTH = 32;
+
+// Elements per block when formatting arrays, to bound the size of preallocated buffer space.
+constexpr int64_t ARRAY_BLOCK_SIZE = 1024;
+
+template <typename T>
+_FORCE_INLINE_ char *_format_number(char *p_out, T p_value) {
+	static_assert(std::is_integral_v<T>);
+	return std::to_chars(p_out, p_out + MAX_NUMBER_LENGTH, p_value).ptr;
+}
+
+// Formats floating-point value with the shortest representation that round-trips.
+// Whole numbers are formatted as integers. Non-finite values are written as null (not representable in JSON).
+template <typename T>
+_FORCE_INLINE_ char *_format_float(char *p_out, T p_value) {
+	if (unlikely(!std::isfinite(p_value))) {
+		memcpy(p_out, "null", 4);
+		return p_out + 4;
+	}
+
+	// Whole numbers are common (timestamps, counters) and exact as integers.
+	if (p_value == std::trunc(p_value) && std::abs(p_value) < T(9007199254740992.0)) { // 2^53
+		return std::to_chars(p_out, p_out + MAX_NUMBER_LENGTH, int64_t(p_value)).ptr;
+	}
+
+#ifdef SENTRY_JSON_NO_FLOAT_TO_CHARS
+	// Try the shorter precision first, and use the full one if it doesn't round-trip.
+	int length = snprintf(p_out, MAX_NUMBER_LENGTH, "%.*g", std::numeric_limits<T>::digits10, double(p_value));
+	if (T(strtod(p_out, nullptr)) != p_value) {
+		length = snprintf(p_out, MAX_NUMBER_LENGTH, "%.*g", std::numeric_limits<T>::max_digits10, double(p_value));
+	}
+	return p_out + length;
+#else
+	return std::to_chars(p_out, p_out + MAX_NUMBER_LENGTH, p_value).ptr;
+#endif
+}
+
+_FORCE_INLINE_ char *_format_number(char *p_out, float p_value) {
+	return _format_float(p_out, p_value);
+}
+
+_FORCE_INLINE_ char *_format_number(char *p_out, double p_value) {
+	return _format_float(p_out, p_value);
+}
+
+// Formats vector component like Godot's String::num_real(): whole numbers get ".0".
+template <typename T>
+_FORCE_INLINE_ char *_format_component(char *p_out, T p_value) {
+	if (unlikely(!std::isfinite(p_value))) {
+		const char *str = std::isnan(p_value) ? "nan" : (p_value > 0 ? "inf" : "-inf");
+		size_t length = strlen(str);
+		memcpy(p_out, str, length);
+		return p_out + length;
+	}
+	char *end = _format_float(p_out, p_value);
+	for (char *c = p_out; c < end; c++) {
+		if (*c == '.' || *c == 'e') {
+			return end;
+		}
+	}
+	memcpy(end, ".0", 2);
+	return end + 2;
+}
+
+} // unnamed namespace
+
+namespace sentry::util {
+
+JSONWriter::Sink JSONWriter::file_sink(FILE *p_file) {
+	return [p_file](const char *p_data, size_t p_size) {
+		return std::fwrite(p_data, 1, p_size, p_file) == p_size;
+	};
+}
+
+void JSONWriter::write_quoted(UTF8Buffer &p_buffer, const String &p_str) {
+	const char32_t *src = p_str.ptr();
+	const int64_t length = p_str.length();
+
+	// Worst case: every code point becomes \u00XX.
+	char *start = p_buffer.prepare(length * 6 + 2);
+	char *out = start;
+
+	*(out++) = '"';
+	for (int64_t i = 0; i < length; i++) {
+		char32_t c = src[i];
+		if (c < 0x80) {
+			out = _write_ascii(out, uint8_t(c));
+		} else if (c < 0x800) {
+			*(out++) = char(0xC0 | (c >> 6));
+			*(out++) = char(0x80 | (c & 0x3F));
+		} else if ((c >= 0xD800 && c <= 0xDFFF) || c > 0x10FFFF) {
+			// Not encodable: replace with U+FFFD.
+			memcpy(out, "\xEF\xBF\xBD", 3);
+			out += 3;
+		} else if (c < 0x10000) {
+			*(out++) = char(0xE0 | (c >> 12));
+			*(out++) = char(0x80 | ((c >> 6) & 0x3F));
+			*(out++) = char(0x80 | (c & 0x3F));
+		} else {
+			*(out++) = char(0xF0 | (c >> 18));
+			*(out++) = char(0x80 | ((c >> 12) & 0x3F));
+			*(out++) = char(0x80 | ((c >> 6) & 0x3F));
+			*(out++) = char(0x80 | (c & 0x3F));
+		}
+	}
+	*(out++) = '"';
+
+	p_buffer.commit(out - start);
+}
+
+void JSONWriter::_write_quoted(const char *p_utf8, size_t p_length) {
+	char *start = buffer.prepare(p_length * 6 + 2);
+	char *out = start;
+
+	*(out++) = '"';
+	for (size_t i = 0; i < p_length; i++) {
+		uint8_t c = uint8_t(p_utf8[i]);
+		if (c < 0x80) {
+			out = _write_ascii(out, c);
+		} else {
+			*(out++) = char(c); // multi-byte sequences are copied as is
+		}
+	}
+	*(out++) = '"';
+
+	buffer.commit(out - start);
+}
+
+void JSONWriter::value_float(double p_value) {
+	_maybe_comma();
+	char *out = buffer.prepare(MAX_NUMBER_LENGTH);
+	buffer.commit(_format_float(out, p_value) - out);
+}
+
+template <typename T>
+void JSONWriter::_write_number_array(const T *p_data, int64_t p_size) {
+	begin_array();
+
+	int64_t size = _capped_size(p_size);
+	for (int64_t block_start = 0; block_start < size; block_start += ARRAY_BLOCK_SIZE) {
+		int64_t block_end = MIN(block_start + ARRAY_BLOCK_SIZE, size);
+		char *start = buffer.prepare((block_end - block_start) * (MAX_NUMBER_LENGTH + 1));
+		char *out = start;
+		for (int64_t i = block_start; i < block_end; i++) {
+			if (i > 0) {
+				*(out++) = ',';
+			}
+			out = _format_number(out, p_data[i]);
+		}
+		buffer.commit(out - start);
+		_maybe_flush();
+	}
+
+	end_array();
+}
+
+template <typename T>
+void JSONWriter::_write_vector_array(const T *p_data, int64_t p_size, int p_dims) {
+	begin_array();
+
+	// Per element: comma, quotes, parentheses and components separated with ", ".
+	const size_t max_element_length = 5 + p_dims * (MAX_NUMBER_LENGTH + 4);
+
+	int64_t size = _capped_size(p_size);
+	for (int64_t block_start = 0; block_start < size; block_start += ARRAY_BLOCK_SIZE) {
+		int64_t block_end = MIN(block_start + ARRAY_BLOCK_SIZE, size);
+		char *start = buffer.prepare((block_end - block_start) * max_element_length);
+		char *out = start;
+		for (int64_t i = block_start; i < block_end; i++) {
+			if (i > 0) {
+				*(out++) = ',';
+			}
+			*(out++) = '"';
+			*(out++) = '(';
+			const T *components = p_data + i * p_dims;
+			for (int d = 0; d < p_dims; d++) {
+				if (d > 0) {
+					*(out++) = ',';
+					*(out++) = ' ';
+				}
+				out = _format_component(out, components[d]);
+			}
+			*(out++) = ')';
+			*(out++) = '"';
+		}
+		buffer.commit(out - start);
+		_maybe_flush();
+	}
+
+	end_array();
+}
+
+template void JSONWriter::_write_number_array(const uint8_t *p_data, int64_t p_size);
+template void JSONWriter::_write_number_array(const int32_t *p_data, int64_t p_size);
+template void JSONWriter::_write_number_array(const int64_t *p_data, int64_t p_size);
+template void JSONWriter::_write_number_array(const float *p_data, int64_t p_size);
+template void JSONWriter::_write_number_array(const double *p_data, int64_t p_size);
+template void JSONWriter::_write_vector_array(const float *p_data, int64_t p_size, int p_dims);
+template void JSONWriter::_write_vector_array(const double *p_data, int64_t p_size, int p_dims);
+
+void JSONWriter::value_byte_array(const PackedByteArray &p_array) {
+	if (!bytes_as_base64) {
+		_write_number_array(p_array.ptr(), p_array.size());
+		return;
+	}
+
+	static constexpr char BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	_maybe_comma();
+	buffer.append_char('"');
+
+	const uint8_t *data = p_array.ptr();
+	int64_t size = _capped_size(p_array.size());
+	constexpr int64_t BLOCK_BYTES = ARRAY_BLOCK_SIZE * 3;
+	for (int64_t block_start = 0; block_start < size; block_start += BLOCK_BYTES) {
+		int64_t block_end = MIN(block_start + BLOCK_BYTES, size);
+		char *start = buffer.prepare((block_end - block_start + 2) / 3 * 4);
+		char *out = start;
+		int64_t i = block_start;
+		for (; i + 2 < block_end; i += 3) {
+			uint32_t triple = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+			*(out++) = BASE64[(triple >> 18) & 0x3F];
+			*(out++) = BASE64[(triple >> 12) & 0x3F];
+			*(out++) = BASE64[(triple >> 6) & 0x3F];
+			*(out++) = BASE64[triple & 0x3F];
+		}
+		// Only the last block can have a remainder, since BLOCK_BYTES is a multiple of 3.
+		if (i < block_end) {
+			uint32_t triple = uint32_t(data[i]) << 16;
+			if (i + 1 < block_end) {
+				triple |= uint32_t(data[i + 1]) << 8;
+			}
+			*(out++) = BASE64[(triple >> 18) & 0x3F];
+			*(out++) = BASE64[(triple >> 12) & 0x3F];
+			*(out++) = (i + 1 < block_end) ? BASE64[(triple >> 6) & 0x3F] : '=';
+			*(out++) = '=';
+		}
+		buffer.commit(out - start);
+		_maybe_flush();
+	}
+
+	buffer.append_char('"');
+}
+
+void JSONWriter::value_dictionary(const Dictionary &p_dictionary) {
+	if (variant_depth >= VARIANT_CONVERSION_MAX_DEPTH) {
+		value_string("{...}");
+		return;
+	}
+	variant_depth++;
+	begin_object();
+	Array keys = p_dictionary.keys();
+	for (int64_t i = 0; i < keys.size(); i++) {
+		const Variant &dict_key = keys[i];
+		key(dict_key.get_type() == Variant::STRING ? dict_key.operator String() : dict_key.stringify());
+		value_variant(p_dictionary[dict_key]);
+	}
+	end_object();
+	variant_depth--;
+}
+
+void JSONWriter::value_array(const Array &p_array) {
+	if (variant_depth >= VARIANT_CONVERSION_MAX_DEPTH) {
+		value_string("[...]");
+		return;
+	}
+	variant_depth++;
+	value_typed_array<Array, const Variant &, &JSONWriter::value_variant>(p_array);
+	variant_depth--;
+}
+
+CharString JSONWriter::get_char_string() const {
+	CharString result;
+	result.resize(buffer.get_size() + 1);
+	memcpy(result.ptrw(), buffer.ptr(), buffer.get_size());
+	result.ptrw()[buffer.get_size()] = '\0';
+	return result;
+}
+
+bool JSONWriter::flush() {
+	if (!sink) {
+		return true;
+	}
+	if (!sink_failed && buffer.get_size() > 0) {
+		sink_failed = !sink(buffer.ptr(), buffer.get_size());
+	}
+	buffer.clear();
+	return !sink_failed;
+}
+
+} // namespace sentry::util
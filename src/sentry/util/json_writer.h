@@ -1,87 +1,156 @@
 #pragma once
 
+#include "sentry/util/utf8_buffer.h"
+
+#include <charconv>
+#include <cstdio>
+#include <functional>
 #include <godot_cpp/variant/variant.hpp>
 
 namespace sentry::util {
 
 using namespace godot;
 
-// Lightweight JSON writer for efficient JSON string construction.
-// Builds JSON directly into a String without intermediate Dictionary/Array allocations.
+// Lightweight JSON writer for efficient JSON construction.
+// Writes UTF-8 directly into a buffer without intermediate Dictionary/Array or String allocations:
+// strings are escaped in place and numbers are formatted with std::to_chars.
+// Output is kept in memory (see get_utf8() and get_string()) or streamed in chunks to a sink.
 class JSONWriter {
+public:
+	// Receives consecutive chunks of UTF-8 output. Returns false on failure, which stops further output.
+	using Sink = std::function<bool(const char *p_data, size_t p_size)>;
+
+	// Sink that writes to an open file.
+	static Sink file_sink(FILE *p_file);
+
+	// Appends a quoted JSON string to the buffer, converting to UTF-8 and escaping in a single pass.
+	static void write_quoted(UTF8Buffer &p_buffer, const String &p_str);
+
 private:
-	String json;
+	static constexpr size_t SINK_CHUNK_SIZE = 16 * 1024;
+
+	UTF8Buffer buffer;
+	Sink sink;
+	bool sink_failed = false;
 	bool needs_comma = false;
 
-	void _maybe_comma() {
+	bool bytes_as_base64 = false;
+	int64_t max_array_elements = 0;
+	int variant_depth = 0;
+
+	_FORCE_INLINE_ void _maybe_comma() {
 		if (needs_comma) {
-			json += ",";
+			buffer.append_char(',');
 		}
 		needs_comma = true;
 	}
 
+	_FORCE_INLINE_ void _maybe_flush() {
+		if (sink && buffer.get_size() >= SINK_CHUNK_SIZE) {
+			flush();
+		}
+	}
+
+	_FORCE_INLINE_ void _write_quoted(const String &p_str) { write_quoted(buffer, p_str); }
+	void _write_quoted(const char *p_utf8, size_t p_length);
+
+	_FORCE_INLINE_ int64_t _capped_size(int64_t p_size) const {
+		return (max_array_elements > 0 && p_size > max_array_elements) ? max_array_elements : p_size;
+	}
+
+	// Writes a whole JSON array of numbers (defined for integer and floating-point element types).
+	template <typename T>
+	void _write_number_array(const T *p_data, int64_t p_size);
+
+	// Writes a JSON array of strings, formatting each p_dims components as a Godot vector/color.
+	template <typename T>
+	void _write_vector_array(const T *p_data, int64_t p_size, int p_dims);
+
 public:
 	// Starts an object: {
 	void begin_object() {
 		_maybe_comma();
-		json += "{";
+		buffer.append_char('{');
 		needs_comma = false;
 	}
 
 	// Ends an object: }
 	void end_object() {
-		json += "}";
+		buffer.append_char('}');
 		needs_comma = true;
+		_maybe_flush();
 	}
 
 	// Starts an array: [
 	void begin_array() {
 		_maybe_comma();
-		json += "[";
+		buffer.append_char('[');
 		needs_comma = false;
 	}
 
 	// Ends an array: ]
 	void end_array() {
-		json += "]";
+		buffer.append_char(']');
 		needs_comma = true;
+		_maybe_flush();
 	}
 
 	// Writes a key (for objects): "key":
 	void key(const String &p_key) {
 		_maybe_comma();
-		json += "\"" + p_key.json_escape() + "\":";
+		_write_quoted(p_key);
+		buffer.append_char(':');
+		needs_comma = false;
+	}
+
+	// Writes a key from UTF-8 C string (e.g., a literal) without converting it to String.
+	void key(const char *p_key) {
+		_maybe_comma();
+		_write_quoted(p_key, strlen(p_key));
+		buffer.append_char(':');
 		needs_comma = false;
 	}
 
 	// Writes an escaped string value: "value"
 	void value_string(const String &p_value) {
 		_maybe_comma();
-		json += "\"" + p_value.json_escape() + "\"";
+		_write_quoted(p_value);
+		_maybe_flush();
 	}
 
-	// Writes an integer value
-	void value_int(int64_t p_value) {
+	// Writes an escaped string value from UTF-8 C string.
+	void value_string(const char *p_value) {
 		_maybe_comma();
-		json += String::num_int64(p_value);
+		_write_quoted(p_value, strlen(p_value));
+		_maybe_flush();
 	}
 
-	// Writes a float value
-	void value_float(double p_value) {
+	// Writes an integer value
+	void value_int(int64_t p_value) {
 		_maybe_comma();
-		json += String::num(p_value, 16);
+		constexpr size_t MAX_LENGTH = 20; // -9223372036854775808
+		char *out = buffer.prepare(MAX_LENGTH);
+		std::to_chars_result result = std::to_chars(out, out + MAX_LENGTH, p_value);
+		buffer.commit(result.ptr - out);
 	}
 
+	// Writes a float value (shortest representation that round-trips; null for NaN and infinity)
+	void value_float(double p_value);
+
 	// Writes a boolean value: true or false
 	void value_bool(bool p_value) {
 		_maybe_comma();
-		json += p_value ? "true" : "false";
+		if (p_value) {
+			buffer.append("true", 4);
+		} else {
+			buffer.append("false", 5);
+		}
 	}
 
 	// Writes a null value
 	void value_null() {
 		_maybe_comma();
-		json += "null";
+		buffer.append("null", 4);
 	}
 
 	// Writes a Variant value (auto-detects type)
@@ -101,7 +170,10 @@ public:
 			} break;
 			case Variant::STRING:
 			case Variant::STRING_NAME: {
-				value_string(p_value);
+				value_string(p_value.operator String());
+			} break;
+			case Variant::DICTIONARY: {
+				value_dictionary(p_value);
 			} break;
 			case Variant::ARRAY: {
 				value_array(p_value);
@@ -144,31 +216,36 @@ public:
 	}
 
 	// Writes a key-value pair with string value
-	void kv_string(const String &p_key, const String &p_value) {
+	template <typename K>
+	void kv_string(const K &p_key, const String &p_value) {
 		key(p_key);
 		value_string(p_value);
 	}
 
 	// Writes a key-value pair with integer value
-	void kv_int(const String &p_key, int64_t p_value) {
+	template <typename K>
+	void kv_int(const K &p_key, int64_t p_value) {
 		key(p_key);
 		value_int(p_value);
 	}
 
 	// Writes a key-value pair with float value
-	void kv_float(const String &p_key, double p_value) {
+	template <typename K>
+	void kv_float(const K &p_key, double p_value) {
 		key(p_key);
 		value_float(p_value);
 	}
 
 	// Writes a key-value pair with boolean value
-	void kv_bool(const String &p_key, bool p_value) {
+	template <typename K>
+	void kv_bool(const K &p_key, bool p_value) {
 		key(p_key);
 		value_bool(p_value);
 	}
 
 	// Writes a key-value pair with Variant value
-	void kv_variant(const String &p_key, const Variant &p_value) {
+	template <typename K>
+	void kv_variant(const K &p_key, const Variant &p_value) {
 		key(p_key);
 		value_variant(p_value);
 	}
@@ -177,49 +254,71 @@ public:
 	template <typename TArray, typename TElement, void (JSONWriter::*TValueFunc)(TElement)>
 	void value_typed_array(const TArray &p_array) {
 		begin_array();
-		for (int i = 0; i < p_array.size(); i++) {
+		int64_t size = _capped_size(p_array.size());
+		for (int64_t i = 0; i < size; i++) {
 			(this->*TValueFunc)(p_array[i]);
 		}
 		end_array();
 	}
 
+	// Writes a Dictionary as an object with stringified keys, and an Array with each element auto-detected.
+	// Values nested deeper than VARIANT_CONVERSION_MAX_DEPTH are written as "{...}" and "[...]".
+	void value_dictionary(const Dictionary &p_dictionary);
+	void value_array(const Array &p_array);
+
 	// Convenience aliases for value_typed_array()
-	void value_array(const Array &p_array) { value_typed_array<Array, const Variant &, &JSONWriter::value_variant>(p_array); }
 	void value_string_array(const PackedStringArray &p_array) { value_typed_array<PackedStringArray, const String &, &JSONWriter::value_string>(p_array); }
-	void value_byte_array(const PackedByteArray &p_array) { value_typed_array<PackedByteArray, int64_t, &JSONWriter::value_int>(p_array); }
-	void value_int32_array(const PackedInt32Array &p_array) { value_typed_array<PackedInt32Array, int64_t, &JSONWriter::value_int>(p_array); }
-	void value_int64_array(const PackedInt64Array &p_array) { value_typed_array<PackedInt64Array, int64_t, &JSONWriter::value_int>(p_array); }
-	void value_float32_array(const PackedFloat32Array &p_array) { value_typed_array<PackedFloat32Array, double, &JSONWriter::value_float>(p_array); }
-	void value_float64_array(const PackedFloat64Array &p_array) { value_typed_array<PackedFloat64Array, double, &JSONWriter::value_float>(p_array); }
-
-	// Writes a typed array with elements converted to strings using Variant::stringify().
-	template <typename TArray>
-	void value_stringify_array(const TArray &p_array) {
-		begin_array();
-		for (int i = 0; i < p_array.size(); i++) {
-			value_string(Variant(p_array[i]).stringify());
-		}
-		end_array();
-	}
 
-	// Convenience aliases for value_stringify_array()
-	void value_vector2_array(const PackedVector2Array &p_array) { value_stringify_array(p_array); }
-	void value_vector3_array(const PackedVector3Array &p_array) { value_stringify_array(p_array); }
-	void value_color_array(const PackedColorArray &p_array) { value_stringify_array(p_array); }
-	void value_vector4_array(const PackedVector4Array &p_array) { value_stringify_array(p_array); }
+	// Numeric packed arrays are formatted in bulk, a block of elements at a time.
+	// Byte arrays are written as base64 string if enabled with set_bytes_as_base64().
+	void value_byte_array(const PackedByteArray &p_array);
+	void value_int32_array(const PackedInt32Array &p_array) { _write_number_array(p_array.ptr(), p_array.size()); }
+	void value_int64_array(const PackedInt64Array &p_array) { _write_number_array(p_array.ptr(), p_array.size()); }
+	void value_float32_array(const PackedFloat32Array &p_array) { _write_number_array(p_array.ptr(), p_array.size()); }
+	void value_float64_array(const PackedFloat64Array &p_array) { _write_number_array(p_array.ptr(), p_array.size()); }
+
+	// Vector and color arrays are written as arrays of strings in Godot's format, e.g., "(1.0, 2.5)".
+	void value_vector2_array(const PackedVector2Array &p_array) { _write_vector_array((const real_t *)p_array.ptr(), p_array.size(), 2); }
+	void value_vector3_array(const PackedVector3Array &p_array) { _write_vector_array((const real_t *)p_array.ptr(), p_array.size(), 3); }
+	void value_color_array(const PackedColorArray &p_array) { _write_vector_array((const float *)p_array.ptr(), p_array.size(), 4); }
+	void value_vector4_array(const PackedVector4Array &p_array) { _write_vector_array((const real_t *)p_array.ptr(), p_array.size(), 4); }
 
 	// Writes a key-value pair with string array value
-	void kv_string_array(const String &p_key, const PackedStringArray &p_array) {
+	template <typename K>
+	void kv_string_array(const K &p_key, const PackedStringArray &p_array) {
 		key(p_key);
 		value_string_array(p_array);
 	}
 
-	// Returns the resulting JSON string
-	String get_string() const {
-		return json;
-	}
+	// Writes PackedByteArray values as base64 strings instead of arrays of numbers.
+	void set_bytes_as_base64(bool p_enabled) { bytes_as_base64 = p_enabled; }
+	bool is_bytes_as_base64() const { return bytes_as_base64; }
+
+	// Limits the number of elements written for each array to bound the payload size; extra elements are omitted.
+	// Zero means no limit. For base64-encoded byte arrays, limits the number of bytes.
+	void set_max_array_elements(int64_t p_max) { max_array_elements = p_max; }
+	int64_t get_max_array_elements() const { return max_array_elements; }
+
+	// Passes buffered output to the sink. Called automatically as output grows; call once more when done.
+	// Returns false if the sink failed.
+	bool flush();
+
+	// Returns the resulting JSON as null-terminated UTF-8. Not available when streaming to a sink.
+	const char *get_utf8() { return buffer.c_str(); }
+	size_t get_utf8_length() const { return buffer.get_size(); }
+
+	// Returns a copy of the resulting JSON as CharString. Not available when streaming to a sink.
+	CharString get_char_string() const;
+
+	// Returns the resulting JSON string. Not available when streaming to a sink.
+	String get_string() const { return String::utf8(buffer.ptr(), buffer.get_size()); }
+
+	explicit JSONWriter(size_t p_capacity = 1024) :
+			buffer(p_capacity) {}
 
-	JSONWriter() = default;
+	// Streams output to p_sink instead of accumulating it in memory.
+	explicit JSONWriter(const Sink &p_sink) :
+			buffer(SINK_CHUNK_SIZE * 2), sink(p_sink) {}
 };
 
 } // namespace sentry::util
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <cstdint>
+#include <godot_cpp/core/defs.hpp>
+#include <utility>
+#include <vector>
+
+namespace sentry::util {
+
+// Fixed-capacity map from 64-bit keys to values, ordered by recency of insertion, update or touch.
+// When full, inserting a new key evicts the least recently put entry.
+// All storage is allocated when the capacity is set, and find, put and eviction are O(1).
+// Keys are expected to be well-distributed hashes (they're used for bucket selection as is).
+// Not thread-safe.
+template <typename V>
+class LRUMap {
+private:
+	static constexpr int32_t NIL = -1;
+
+	struct Entry {
+		uint64_t key = 0;
+		V value{};
+		int32_t prev = NIL; // toward the most recent entry
+		int32_t next = NIL; // toward the least recent entry
+	};
+
+	std::vector<Entry> entries;
+	std::vector<int32_t> buckets; // linear probing table of entry indices, sized to a power of two
+	uint64_t mask = 0;
+	int32_t head = NIL; // most recent
+	int32_t tail = NIL; // least recent
+	int32_t free_list = NIL; // chained through Entry::next
+	int32_t used = 0; // entries ever taken from the end of the array
+	int32_t count = 0;
+
+	_FORCE_INLINE_ uint64_t _home(uint64_t p_key) const { return (p_key ^ (p_key >> 32)) & mask; }
+
+	uint64_t _find_bucket(uint64_t p_key) const {
+		uint64_t b = _home(p_key);
+		while (buckets[b] != NIL && entries[buckets[b]].key != p_key) {
+			b = (b + 1) & mask;
+		}
+		return b;
+	}
+
+	void _unlink(int32_t p_idx) {
+		Entry &e = entries[p_idx];
+		if (e.prev != NIL) {
+			entries[e.prev].next = e.next;
+		} else {
+			head = e.next;
+		}
+		if (e.next != NIL) {
+			entries[e.next].prev = e.prev;
+		} else {
+			tail = e.prev;
+		}
+		e.prev = NIL;
+		e.next = NIL;
+	}
+
+	void _push_front(int32_t p_idx) {
+		Entry &e = entries[p_idx];
+		e.prev = NIL;
+		e.next = head;
+		if (head != NIL) {
+			entries[head].prev = p_idx;
+		}
+		head = p_idx;
+		if (tail == NIL) {
+			tail = p_idx;
+		}
+	}
+
+	// Empties the bucket, shifting back later entries of the same probe run (no tombstones needed).
+	void _erase_bucket(uint64_t p_bucket) {
+		uint64_t i = p_bucket;
+		uint64_t j = p_bucket;
+		while (true) {
+			j = (j + 1) & mask;
+			if (buckets[j] == NIL) {
+				break;
+			}
+			uint64_t k = _home(entries[buckets[j]].key);
+			// Skip entries whose home bucket lies cyclically in (i, j] – they are still reachable.
+			bool reachable = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+			if (reachable) {
+				continue;
+			}
+			buckets[i] = buckets[j];
+			i = j;
+		}
+		buckets[i] = NIL;
+	}
+
+	void _remove(int32_t p_idx) {
+		_erase_bucket(_find_bucket(entries[p_idx].key));
+		_unlink(p_idx);
+		entries[p_idx].value = V{};
+		entries[p_idx].next = free_list;
+		free_list = p_idx;
+		count--;
+	}
+
+public:
+	// Drops all entries and reallocates storage for the given number of entries.
+	void reset(int32_t p_capacity) {
+		p_capacity = p_capacity > 0 ? p_capacity : 1;
+		uint64_t num_buckets = 2;
+		while (num_buckets < uint64_t(p_capacity) * 2) {
+			num_buckets *= 2;
+		}
+		entries.assign(p_capacity, Entry());
+		buckets.assign(num_buckets, NIL);
+		mask = num_buckets - 1;
+		head = NIL;
+		tail = NIL;
+		free_list = NIL;
+		used = 0;
+		count = 0;
+	}
+
+	void clear() { reset(capacity()); }
+
+	_FORCE_INLINE_ int32_t size() const { return count; }
+	_FORCE_INLINE_ int32_t capacity() const { return (int32_t)entries.size(); }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+
+	// Returns pointer to the value stored for the key or nullptr. Doesn't affect recency.
+	V *find(uint64_t p_key) {
+		if (entries.empty()) {
+			return nullptr;
+		}
+		int32_t idx = buckets[_find_bucket(p_key)];
+		return idx != NIL ? &entries[idx].value : nullptr;
+	}
+
+	// Same as find, but also marks the entry as the most recent one.
+	V *touch(uint64_t p_key) {
+		if (entries.empty()) {
+			return nullptr;
+		}
+		int32_t idx = buckets[_find_bucket(p_key)];
+		if (idx == NIL) {
+			return nullptr;
+		}
+		if (idx != head) {
+			_unlink(idx);
+			_push_front(idx);
+		}
+		return &entries[idx].value;
+	}
+
+	// Inserts or updates the value and marks the entry as the most recent one.
+	void put(uint64_t p_key, V p_value) {
+		if (entries.empty()) {
+			reset(1);
+		}
+
+		uint64_t b = _find_bucket(p_key);
+		int32_t idx = buckets[b];
+		if (idx != NIL) {
+			entries[idx].value = std::move(p_value);
+			if (idx != head) {
+				_unlink(idx);
+				_push_front(idx);
+			}
+			return;
+		}
+
+		if (count == capacity()) {
+			pop_oldest();
+			b = _find_bucket(p_key); // eviction may have shifted buckets
+		}
+
+		if (free_list != NIL) {
+			idx = free_list;
+			free_list = entries[idx].next;
+		} else {
+			idx = used++;
+		}
+
+		entries[idx].key = p_key;
+		entries[idx].value = std::move(p_value);
+		buckets[b] = idx;
+		_push_front(idx);
+		count++;
+	}
+
+	// Returns the least recent value or nullptr if empty.
+	V *oldest() { return tail != NIL ? &entries[tail].value : nullptr; }
+
+	void pop_oldest() {
+		if (tail != NIL) {
+			_remove(tail);
+		}
+	}
+
+	void erase(uint64_t p_key) {
+		if (entries.empty()) {
+			return;
+		}
+		int32_t idx = buckets[_find_bucket(p_key)];
+		if (idx != NIL) {
+			_remove(idx);
+		}
+	}
+};
+
+} //namespace sentry::util
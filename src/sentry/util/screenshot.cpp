@@ -1,5 +1,7 @@
 #include "screenshot.h"
 
+#include "sentry/common_defs.h"
+
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
@@ -10,15 +12,62 @@ using namespace godot;
 
 namespace sentry::util {
 
-PackedByteArray take_screenshot() {
+Ref<Image> capture_screenshot() {
 	SceneTree *sml = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
-	ERR_FAIL_NULL_V_MSG(sml, PackedByteArray(), "Sentry: Failed to capture screenshot - couldn't get scene tree.");
+	ERR_FAIL_NULL_V_MSG(sml, Ref<Image>(), "Sentry: Failed to capture screenshot - couldn't get scene tree.");
 
 	Window *main_window = sml->get_root();
-	ERR_FAIL_NULL_V_MSG(main_window, PackedByteArray(), "Sentry: Failed to capture screenshot - couldn't get main window.");
+	ERR_FAIL_NULL_V_MSG(main_window, Ref<Image>(), "Sentry: Failed to capture screenshot - couldn't get main window.");
 
 	Ref<ViewportTexture> tex = main_window->get_texture();
-	return tex->get_image()->save_jpg_to_buffer();
+	return tex->get_image();
+}
+
+PackedByteArray encode_screenshot(const Ref<Image> &p_image, const ScreenshotSettings &p_settings) {
+	ERR_FAIL_COND_V(p_image.is_null() || p_image->is_empty(), PackedByteArray());
+
+	Ref<Image> image = p_image;
+	int width = image->get_width();
+	int height = image->get_height();
+	int longest = MAX(width, height);
+	if (p_settings.max_size > 0 && longest > p_settings.max_size) {
+		double scale = double(p_settings.max_size) / longest;
+		image->resize(MAX(1, int(width * scale)), MAX(1, int(height * scale)), Image::INTERPOLATE_BILINEAR);
+	}
+
+	switch (p_settings.format) {
+		case SentryOptions::SCREENSHOT_FORMAT_PNG:
+			return image->save_png_to_buffer();
+		case SentryOptions::SCREENSHOT_FORMAT_WEBP:
+			return image->save_webp_to_buffer(true, p_settings.quality);
+		case SentryOptions::SCREENSHOT_FORMAT_JPEG:
+		default:
+			return image->save_jpg_to_buffer(p_settings.quality);
+	}
+}
+
+const char *get_screenshot_file_name(SentryOptions::ScreenshotFormat p_format) {
+	switch (p_format) {
+		case SentryOptions::SCREENSHOT_FORMAT_PNG:
+			return SENTRY_SCREENSHOT_PNG_FN;
+		case SentryOptions::SCREENSHOT_FORMAT_WEBP:
+			return SENTRY_SCREENSHOT_WEBP_FN;
+		case SentryOptions::SCREENSHOT_FORMAT_JPEG:
+		default:
+			return SENTRY_SCREENSHOT_FN;
+	}
+}
+
+const char *get_screenshot_content_type(SentryOptions::ScreenshotFormat p_format) {
+	switch (p_format) {
+		case SentryOptions::SCREENSHOT_FORMAT_PNG:
+			return "image/png";
+		case SentryOptions::SCREENSHOT_FORMAT_WEBP:
+			return "image/webp";
+		case SentryOptions::SCREENSHOT_FORMAT_JPEG:
+		default:
+			return "image/jpeg";
+	}
 }
 
 } //namespace sentry::util
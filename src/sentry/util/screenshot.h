@@ -1,13 +1,24 @@
 #pragma once
 
-namespace godot {
+#include "sentry/sentry_options.h"
 
-class PackedByteArray;
-
-}
+#include <godot_cpp/classes/image.hpp>
 
 namespace sentry::util {
 
-godot::PackedByteArray take_screenshot();
+struct ScreenshotSettings {
+	SentryOptions::ScreenshotFormat format = SentryOptions::SCREENSHOT_FORMAT_JPEG;
+	float quality = 0.75;
+	int max_size = 0; // longest side in pixels, 0 means no limit
+};
+
+// Reads back the main window's contents. Main thread only.
+godot::Ref<godot::Image> capture_screenshot();
+
+// Downscales and encodes a captured screenshot. Can be called from any thread.
+godot::PackedByteArray encode_screenshot(const godot::Ref<godot::Image> &p_image, const ScreenshotSettings &p_settings);
+
+const char *get_screenshot_file_name(SentryOptions::ScreenshotFormat p_format);
+const char *get_screenshot_content_type(SentryOptions::ScreenshotFormat p_format);
 
 }
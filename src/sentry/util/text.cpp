@@ -1,9 +1,77 @@
 #include "text.h"
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SENTRY_TEXT_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SENTRY_TEXT_NEON
+#endif
+
 using namespace godot;
 
 namespace {
 
+_FORCE_INLINE_ bool _is_invisible(char32_t c) {
+	return c < 0x20 || c == 0x7F;
+}
+
+// Code points checked per SIMD iteration.
+constexpr int64_t BLOCK_SIZE = 16;
+
+// Returns true if the block of 16 code points may contain invisible characters.
+// May report false positives (for out-of-range code points), never false negatives.
+_FORCE_INLINE_ bool _block_may_have_invisible(const char32_t *p_block) {
+#if defined(SENTRY_TEXT_SSE2)
+	// Valid code points fit into signed 32-bit range, so a signed comparison is fine here.
+	const __m128i space = _mm_set1_epi32(0x20);
+	const __m128i del = _mm_set1_epi32(0x7F);
+	__m128i found = _mm_setzero_si128();
+	for (int k = 0; k < BLOCK_SIZE; k += 4) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_block + k));
+		found = _mm_or_si128(found, _mm_or_si128(_mm_cmplt_epi32(v, space), _mm_cmpeq_epi32(v, del)));
+	}
+	return _mm_movemask_epi8(found) != 0;
+#elif defined(SENTRY_TEXT_NEON)
+	const uint32x4_t space = vdupq_n_u32(0x20);
+	const uint32x4_t del = vdupq_n_u32(0x7F);
+	uint32x4_t found = vdupq_n_u32(0);
+	for (int k = 0; k < BLOCK_SIZE; k += 4) {
+		uint32x4_t v = vld1q_u32(reinterpret_cast<const uint32_t *>(p_block + k));
+		found = vorrq_u32(found, vorrq_u32(vcltq_u32(v, space), vceqq_u32(v, del)));
+	}
+	return vmaxvq_u32(found) != 0;
+#else
+	bool found = false;
+	for (int k = 0; k < BLOCK_SIZE; k++) {
+		found |= _is_invisible(p_block[k]);
+	}
+	return found;
+#endif
+}
+
+// Returns index of the first invisible character in [p_from, p_len), or p_len if there is none.
+int64_t _find_invisible(const char32_t *p_data, int64_t p_from, int64_t p_len) {
+	int64_t i = p_from;
+	for (; i + BLOCK_SIZE <= p_len; i += BLOCK_SIZE) {
+		if (_block_may_have_invisible(p_data + i)) {
+			for (int64_t j = i; j < i + BLOCK_SIZE; j++) {
+				if (_is_invisible(p_data[j])) {
+					return j;
+				}
+			}
+		}
+	}
+	for (; i < p_len; i++) {
+		if (_is_invisible(p_data[i])) {
+			return i;
+		}
+	}
+	return p_len;
+}
+
 #ifdef DEBUG_ENABLED
 bool _has_no_uppercase_ascii(std::string_view p_string) {
 	for (char c : p_string) {
@@ -45,4 +113,46 @@ bool ends_with_nocase_ascii(const String &p_text, std::string_view p_lowercase_s
 	return true;
 }
 
+String strip_invisible(const String &p_text) {
+	const char32_t *src = p_text.ptr();
+	const int64_t length = p_text.length();
+
+	int64_t i = _find_invisible(src, 0, length);
+	if (i == length) {
+		return p_text;
+	}
+
+	// Result can only be shorter – allocate once and copy visible runs in bulk.
+	String result;
+	result.resize(length + 1);
+	char32_t *dst = result.ptrw();
+	std::memcpy(dst, src, i * sizeof(char32_t));
+	int64_t written = i;
+
+	while (i < length) {
+		// Here, src[i] is always an invisible character.
+		if (src[i] == 0x1B && i + 1 < length && src[i + 1] == '[') {
+			// ANSI escape sequence: ESC (0x1B) + '['. Skip until we reach a final byte (0x40-0x7E).
+			i += 2;
+			while (i < length) {
+				char32_t c = src[i++];
+				if (c >= 0x40 && c <= 0x7E) {
+					break;
+				}
+			}
+		} else {
+			i++;
+		}
+
+		int64_t next = _find_invisible(src, i, length);
+		std::memcpy(dst + written, src + i, (next - i) * sizeof(char32_t));
+		written += next - i;
+		i = next;
+	}
+
+	dst[written] = 0;
+	result.resize(written + 1);
+	return result;
+}
+
 } //namespace sentry::util
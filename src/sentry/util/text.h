@@ -9,4 +9,8 @@ namespace sentry::util {
 // Suffix must contain only lowercase ASCII characters.
 bool ends_with_nocase_ascii(const godot::String &p_string, std::string_view p_lowercase_suffix);
 
+// Removes ANSI escape sequences and control characters (< 0x20 and DEL).
+// Returns the original string without copying if there is nothing to remove.
+godot::String strip_invisible(const godot::String &p_text);
+
 } // namespace sentry::util
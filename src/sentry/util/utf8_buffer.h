@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <godot_cpp/variant/string.hpp>
 
 namespace sentry::util {
@@ -53,18 +54,41 @@ public:
 		capacity = 0;
 	}
 
-	const char *ptr() {
+	const char *ptr() const {
 		return start;
 	}
 
-	size_t get_size() {
+	size_t get_size() const {
 		return write - start;
 	}
 
-	size_t get_capacity() {
+	size_t get_capacity() const {
 		return capacity;
 	}
 
+	// Discards the contents, keeping the allocated capacity.
+	void clear() {
+		write = start;
+	}
+
+	// Returns contents as a null-terminated string (terminator is not counted in size).
+	const char *c_str() {
+		_ensure_capacity(get_size() + 1);
+		*write = '\0';
+		return start;
+	}
+
+	// Returns pointer where at least p_max_size bytes can be written directly, to be followed by commit().
+	char *prepare(size_t p_max_size) {
+		_ensure_capacity(get_size() + p_max_size + 1);
+		return write;
+	}
+
+	// Accounts for p_size bytes written to the pointer returned by prepare().
+	void commit(size_t p_size) {
+		write += p_size;
+	}
+
 	void reserve(size_t p_size) {
 		capacity = p_size;
 		size_t used = get_size();
@@ -72,6 +96,17 @@ public:
 		write = start + used;
 	}
 
+	void append_char(char p_char) {
+		_ensure_capacity(get_size() + 2);
+		*(write++) = p_char;
+	}
+
+	void append(const char *p_data, size_t p_length) {
+		_ensure_capacity(get_size() + p_length + 1);
+		memcpy(write, p_data, p_length);
+		write += p_length;
+	}
+
 	void append(const char *p_cstr) {
 		const size_t length = strlen(p_cstr);
 		_ensure_capacity(get_size() + length + 1);
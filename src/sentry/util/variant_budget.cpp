@@ -0,0 +1,187 @@
+#include "variant_budget.h"
+
+#include "sentry/common_defs.h"
+
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+using namespace godot;
+
+namespace {
+
+// Returns true and sets r_result if the value had to be trimmed; otherwise leaves r_result untouched.
+bool _fit(const Variant &p_value, int p_depth, int &r_items_left, Variant &r_result) {
+	switch (p_value.get_type()) {
+		case Variant::STRING: {
+			const String &str = p_value;
+			if (str.length() <= sentry::VARIABLE_MAX_STRING_LENGTH) {
+				return false;
+			}
+			r_result = str.substr(0, sentry::VARIABLE_MAX_STRING_LENGTH) + "...";
+			return true;
+		} break;
+		case Variant::DICTIONARY: {
+			if (p_depth >= sentry::VARIABLE_MAX_DEPTH) {
+				r_result = "{...}";
+				return true;
+			}
+
+			Dictionary dict = p_value;
+			const Array &keys = dict.keys();
+			Dictionary trimmed;
+			bool changed = false;
+			for (int i = 0; i < keys.size(); i++) {
+				const Variant &key = keys[i];
+				if (r_items_left <= 0) {
+					if (!changed) {
+						// Copy what fit so far.
+						for (int j = 0; j < i; j++) {
+							trimmed[keys[j]] = dict[keys[j]];
+						}
+						changed = true;
+					}
+					break;
+				}
+				r_items_left--;
+
+				Variant value = dict[key];
+				Variant fitted;
+				if (_fit(value, p_depth + 1, r_items_left, fitted)) {
+					if (!changed) {
+						for (int j = 0; j < i; j++) {
+							trimmed[keys[j]] = dict[keys[j]];
+						}
+						changed = true;
+					}
+					trimmed[key] = fitted;
+				} else if (changed) {
+					trimmed[key] = value;
+				}
+			}
+			if (changed) {
+				r_result = trimmed;
+			}
+			return changed;
+		} break;
+		case Variant::ARRAY:
+		case Variant::PACKED_BYTE_ARRAY:
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_STRING_ARRAY:
+		case Variant::PACKED_VECTOR2_ARRAY:
+		case Variant::PACKED_VECTOR3_ARRAY:
+		case Variant::PACKED_COLOR_ARRAY:
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			if (p_depth >= sentry::VARIABLE_MAX_DEPTH) {
+				r_result = "[...]";
+				return true;
+			}
+
+			// Trimmed collections become untyped arrays.
+			Array trimmed;
+			bool changed = false;
+			bool oob = false;
+			bool valid = true;
+			int i = 0;
+			while (true) {
+				Variant item = p_value.get_indexed(i, valid, oob);
+				if (oob) {
+					break;
+				}
+				if (r_items_left <= 0) {
+					if (!changed) {
+						for (int j = 0; j < i; j++) {
+							trimmed.append(p_value.get_indexed(j, valid, oob));
+						}
+						changed = true;
+					}
+					break;
+				}
+				r_items_left--;
+
+				Variant fitted;
+				if (_fit(item, p_depth + 1, r_items_left, fitted)) {
+					if (!changed) {
+						for (int j = 0; j < i; j++) {
+							trimmed.append(p_value.get_indexed(j, valid, oob));
+						}
+						changed = true;
+					}
+					trimmed.append(fitted);
+				} else if (changed) {
+					trimmed.append(item);
+				}
+				i++;
+			}
+			if (changed) {
+				r_result = trimmed;
+			}
+			return changed;
+		} break;
+		default: {
+			return false;
+		} break;
+	}
+}
+
+// Copies shared containers and stringifies anything that references objects, within the same budgets as _fit().
+Variant _snapshot(const Variant &p_value, int p_depth, int &r_items_left) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL: {
+			return _snapshot(p_value.stringify(), p_depth, r_items_left);
+		} break;
+		case Variant::DICTIONARY: {
+			if (p_depth >= sentry::VARIABLE_MAX_DEPTH) {
+				return "{...}";
+			}
+			Dictionary dict = p_value;
+			const Array &keys = dict.keys();
+			Dictionary copy;
+			for (int i = 0; i < keys.size() && r_items_left > 0; i++) {
+				r_items_left--;
+				const Variant &key = keys[i];
+				Variant key_copy = key.get_type() == Variant::OBJECT ? Variant(key.stringify()) : key;
+				copy[key_copy] = _snapshot(dict[key], p_depth + 1, r_items_left);
+			}
+			return copy;
+		} break;
+		case Variant::ARRAY: {
+			if (p_depth >= sentry::VARIABLE_MAX_DEPTH) {
+				return "[...]";
+			}
+			Array array = p_value;
+			Array copy;
+			for (int i = 0; i < array.size() && r_items_left > 0; i++) {
+				r_items_left--;
+				copy.append(_snapshot(array[i], p_depth + 1, r_items_left));
+			}
+			return copy;
+		} break;
+		default: {
+			// Strings and packed arrays are copy-on-write, so the trimmed or original value is safe to share.
+			Variant fitted;
+			return _fit(p_value, p_depth, r_items_left, fitted) ? fitted : p_value;
+		} break;
+	}
+}
+
+} // unnamed namespace
+
+namespace sentry::util {
+
+Variant fit_variant_to_budget(const Variant &p_value) {
+	int items_left = sentry::VARIABLE_MAX_ITEMS;
+	Variant fitted;
+	return _fit(p_value, 0, items_left, fitted) ? fitted : p_value;
+}
+
+Variant snapshot_variant(const Variant &p_value) {
+	int items_left = sentry::VARIABLE_MAX_ITEMS;
+	return _snapshot(p_value, 0, items_left);
+}
+
+} // namespace sentry::util
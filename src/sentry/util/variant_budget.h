@@ -0,0 +1,18 @@
+#pragma once
+
+#include <godot_cpp/variant/variant.hpp>
+
+namespace sentry::util {
+
+// Returns the value trimmed to fit the script variable budgets (see common_defs.h):
+// strings are shortened, collections nested too deep are replaced with a placeholder,
+// and collection elements beyond the item budget are dropped.
+// If the value already fits, it's returned as is, without copying.
+godot::Variant fit_variant_to_budget(const godot::Variant &p_value);
+
+// Like fit_variant_to_budget(), but always returns a copy that can be serialized on another thread:
+// arrays and dictionaries are copied, and objects are replaced with their string form.
+// Must be called on the thread that owns the value.
+godot::Variant snapshot_variant(const godot::Variant &p_value);
+
+} // namespace sentry::util
@@ -0,0 +1,98 @@
+#ifdef BENCHMARKS_ENABLED
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+namespace {
+
+thread_local uint64_t tl_allocation_count = 0;
+
+} // unnamed namespace
+
+// Replaced global allocation functions to count allocations in benchmarks.
+// Array and nothrow variants forward to these by default.
+
+void *operator new(std::size_t p_size) {
+	tl_allocation_count++;
+	void *ptr = std::malloc(p_size ? p_size : 1);
+	if (!ptr) {
+		std::abort(); // Built without exceptions.
+	}
+	return ptr;
+}
+
+void operator delete(void *p_ptr) noexcept {
+	std::free(p_ptr);
+}
+
+void operator delete(void *p_ptr, std::size_t) noexcept {
+	std::free(p_ptr);
+}
+
+namespace sentry::tests {
+
+uint64_t get_thread_allocation_count() {
+	return tl_allocation_count;
+}
+
+int64_t get_engine_memory_usage() {
+	return int64_t(OS::get_singleton()->get_static_memory_usage());
+}
+
+void Benchmark::report() {
+	if (samples_ns.empty()) {
+		UtilityFunctions::print(String("  ") + name + ": no samples");
+		return;
+	}
+
+	std::sort(samples_ns.begin(), samples_ns.end());
+
+	int64_t total_ns = 0;
+	for (int64_t sample : samples_ns) {
+		total_ns += sample;
+	}
+
+	size_t count = samples_ns.size();
+	auto percentile_us = [&](double p_fraction) {
+		size_t idx = std::min(count - 1, static_cast<size_t>(p_fraction * count));
+		return samples_ns[idx] / 1000.0;
+	};
+
+	double calls_per_sec = total_ns > 0 ? count * 1e9 / total_ns : 0.0;
+	double allocs_per_call = static_cast<double>(allocations) / count;
+
+	// Engine memory is only tracked in debug builds. It's the net change, so memory freed within the call doesn't show,
+	// but anything the call keeps around (queued records, caches, leaks) does.
+	char engine_column[32];
+	if (OS::get_singleton()->is_debug_build()) {
+		snprintf(engine_column, sizeof(engine_column), "%+9.1f engine B/call", static_cast<double>(engine_bytes) / count);
+	} else {
+		snprintf(engine_column, sizeof(engine_column), "%9s engine B/call", "n/a");
+	}
+
+	char line[320];
+	snprintf(line, sizeof(line),
+			"  %-36s %8zu calls %12.0f calls/s   p50 %8.2f us   p90 %8.2f us   p99 %8.2f us   max %9.2f us   %6.2f C++ allocs/call   %s",
+			name, count, calls_per_sec,
+			percentile_us(0.5), percentile_us(0.9), percentile_us(0.99), samples_ns.back() / 1000.0,
+			allocs_per_call, engine_column);
+	UtilityFunctions::print(line);
+}
+
+Benchmark::Benchmark(const char *p_name, int p_expected_calls) :
+		name(p_name) {
+	samples_ns.reserve(p_expected_calls);
+}
+
+} // namespace sentry::tests
+
+#endif // BENCHMARKS_ENABLED
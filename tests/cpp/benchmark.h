@@ -0,0 +1,50 @@
+#pragma once
+
+#ifdef BENCHMARKS_ENABLED
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace sentry::tests {
+
+// Number of heap allocations made through operator new on the calling thread so far.
+// Allocations done by the engine on behalf of Godot types (String, Array, etc.) aren't visible here.
+uint64_t get_thread_allocation_count();
+
+// Bytes currently allocated through the engine's allocator, including Godot types created by the extension.
+// Only tracked by debug builds of the engine; 0 otherwise.
+int64_t get_engine_memory_usage();
+
+// Collects per-call latency and allocation samples, and prints a one-line summary.
+// Usage: call measure() in a loop, then report().
+class Benchmark {
+private:
+	const char *name;
+	std::vector<int64_t> samples_ns;
+	uint64_t allocations = 0;
+	int64_t engine_bytes = 0;
+
+public:
+	template <typename F>
+	void measure(F &&p_func) {
+		int64_t engine_before = get_engine_memory_usage();
+		uint64_t allocs_before = get_thread_allocation_count();
+		auto start = std::chrono::steady_clock::now();
+		p_func();
+		auto end = std::chrono::steady_clock::now();
+		allocations += get_thread_allocation_count() - allocs_before;
+		engine_bytes += get_engine_memory_usage() - engine_before;
+		samples_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+	}
+
+	// Prints throughput, latency percentiles (p50, p90, p99, max), C++ allocations per call,
+	// and the change in engine memory per call (debug builds only).
+	void report();
+
+	explicit Benchmark(const char *p_name, int p_expected_calls = 0);
+};
+
+} // namespace sentry::tests
+
+#endif // BENCHMARKS_ENABLED
@@ -0,0 +1,273 @@
+// Benchmarks for the SentryGodotLogger hot path: _log_error() and _log_message().
+//
+// Built with `tests=yes benchmarks=yes` and skipped by default. Run with:
+//   godot --headless --path project/ --editor --test-sentry --test-suite="[Benchmark]*" --no-skip
+//
+// If the SDK isn't initialized yet, it's initialized without a DSN for the duration of each
+// benchmark, so captures go through the whole pipeline but nothing is sent.
+
+#if defined(BENCHMARKS_ENABLED)
+
+#include "benchmark.h"
+
+#include "sentry/logging/sentry_godot_logger.h"
+#include "sentry/sentry_options.h"
+#include "sentry/sentry_sdk.h"
+
+#include <doctest.h>
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/script.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+using namespace sentry;
+
+using sentry::logging::SentryGodotLogger;
+using sentry::tests::Benchmark;
+
+namespace {
+
+constexpr int ITERATIONS = 20000;
+constexpr int SCRIPT_ITERATIONS = 2000; // Capturing script backtraces dominates these.
+constexpr const char *HELPER_PATH = "res://test/cpp/logger_benchmark_helper.gd";
+
+// Logger options used by a benchmark. Unlimited by default, so every call does the full work.
+struct LoggerConfig {
+	bool include_source_context = false;
+	bool include_variables = false;
+	BitField<GodotLoggerEventMask> event_mask = GodotLoggerEventMask::MASK_ERROR | GodotLoggerEventMask::MASK_SCRIPT;
+	BitField<GodotLoggerEventMask> breadcrumb_mask = GodotLoggerEventMask::MASK_NONE;
+	BitField<GodotLoggerEventMask> log_mask = GodotLoggerEventMask::MASK_NONE;
+	bool enable_logs = true;
+	int events_per_frame = 1 << 30;
+	int throttle_events = 1 << 30;
+	int repeated_error_window_ms = 0;
+};
+
+// Applies logger options for the lifetime of the object, then restores the previous ones.
+class ScopedLoggerConfig {
+private:
+	LoggerConfig saved;
+
+	static LoggerConfig _get() {
+		Ref<SentryGodotLoggerOptions> opts = SENTRY_OPTIONS()->get_godot_logger();
+		LoggerConfig config;
+		config.include_source_context = opts->get_include_source_context();
+		config.include_variables = opts->get_include_variables();
+		config.event_mask = opts->get_event_mask();
+		config.breadcrumb_mask = opts->get_breadcrumb_mask();
+		config.log_mask = opts->get_log_mask();
+		config.enable_logs = SENTRY_OPTIONS()->get_enable_logs();
+		config.events_per_frame = opts->get_limits()->get_events_per_frame();
+		config.throttle_events = opts->get_limits()->get_throttle_events();
+		config.repeated_error_window_ms = opts->get_limits()->get_repeated_error_window_ms();
+		return config;
+	}
+
+	static void _set(const LoggerConfig &p_config) {
+		Ref<SentryGodotLoggerOptions> opts = SENTRY_OPTIONS()->get_godot_logger();
+		opts->set_include_source_context(p_config.include_source_context);
+		opts->set_include_variables(p_config.include_variables);
+		opts->set_event_mask(p_config.event_mask);
+		opts->set_breadcrumb_mask(p_config.breadcrumb_mask);
+		opts->set_log_mask(p_config.log_mask);
+		SENTRY_OPTIONS()->set_enable_logs(p_config.enable_logs);
+		opts->get_limits()->set_events_per_frame(p_config.events_per_frame);
+		opts->get_limits()->set_throttle_events(p_config.throttle_events);
+		opts->get_limits()->set_repeated_error_window_ms(p_config.repeated_error_window_ms);
+	}
+
+public:
+	explicit ScopedLoggerConfig(const LoggerConfig &p_config) :
+			saved(_get()) {
+		_set(p_config);
+	}
+
+	~ScopedLoggerConfig() { _set(saved); }
+};
+
+void _configure_benchmark_sdk(const Ref<SentryOptions> &p_options) {
+	p_options->set_dsn(""); // Nothing leaves the process.
+	p_options->get_godot_logger()->set_enabled(false); // Benchmarks create their own logger instances.
+	p_options->set_attach_screenshot(false);
+	p_options->set_attach_scene_tree(false);
+}
+
+// Initializes the SDK for the lifetime of the object, unless it's already initialized.
+class ScopedBenchmarkSDK {
+private:
+	bool owns_sdk = false;
+
+public:
+	ScopedBenchmarkSDK() {
+		if (!SentrySDK::get_singleton()->is_enabled()) {
+			SentrySDK::get_singleton()->init(callable_mp_static(&_configure_benchmark_sdk));
+			owns_sdk = SentrySDK::get_singleton()->is_enabled();
+		}
+	}
+
+	~ScopedBenchmarkSDK() {
+		if (owns_sdk) {
+			SentrySDK::get_singleton()->close();
+		}
+	}
+};
+
+void _bench_log_error(const char *p_name, const LoggerConfig &p_config, bool p_distinct_lines) {
+	ScopedLoggerConfig config{ p_config };
+	Ref<SentryGodotLogger> logger; // Limits are read when the logger is created.
+	logger.instantiate();
+
+	const String function = "bench_function";
+	const String file = "res://bench/bench_source.gd";
+	const String code = "bench_code";
+	const String rationale = "Benchmark error message";
+	const TypedArray<Ref<ScriptBacktrace>> no_backtraces;
+
+	Benchmark bench{ p_name, ITERATIONS };
+	for (int i = 0; i < ITERATIONS; i++) {
+		int line = p_distinct_lines ? i + 1 : 1;
+		bench.measure([&]() {
+			logger->_log_error(function, file, line, code, rationale, false, Logger::ERROR_TYPE_ERROR, no_backtraces);
+		});
+	}
+	bench.report();
+}
+
+// State for errors logged from within GDScript frames (see logger_benchmark_helper.gd).
+struct ScriptBenchState {
+	SentryGodotLogger *logger = nullptr;
+	Benchmark *bench = nullptr;
+};
+
+ScriptBenchState s_script_bench;
+
+void _log_error_from_script(int p_iteration) {
+	// Engine captures backtraces before calling loggers – not part of the measured cost.
+	TypedArray<Ref<ScriptBacktrace>> backtraces = Engine::get_singleton()->capture_script_backtraces(false);
+	s_script_bench.bench->measure([&]() {
+		s_script_bench.logger->_log_error("run", HELPER_PATH, 1, "bench_code", "Benchmark script error",
+				false, Logger::ERROR_TYPE_SCRIPT, backtraces);
+	});
+}
+
+void _bench_log_error_from_script(const char *p_name, const LoggerConfig &p_config) {
+	if (!ResourceLoader::get_singleton()->exists(HELPER_PATH)) {
+		MESSAGE("Skipping \"" << p_name << "\": benchmark helper script not found.");
+		return;
+	}
+	Ref<Script> script = ResourceLoader::get_singleton()->load(HELPER_PATH);
+	REQUIRE(script.is_valid());
+	Variant helper = script->call("new");
+
+	ScopedLoggerConfig config{ p_config };
+	Ref<SentryGodotLogger> logger;
+	logger.instantiate();
+
+	Benchmark bench{ p_name, SCRIPT_ITERATIONS };
+	s_script_bench = { logger.ptr(), &bench };
+	helper.call("run", callable_mp_static(&_log_error_from_script), SCRIPT_ITERATIONS);
+	s_script_bench = {};
+
+	bench.report();
+}
+
+void _bench_log_message(const char *p_name, const LoggerConfig &p_config, const String &p_message) {
+	ScopedLoggerConfig config{ p_config };
+	Ref<SentryGodotLogger> logger;
+	logger.instantiate();
+
+	Benchmark bench{ p_name, ITERATIONS };
+	for (int i = 0; i < ITERATIONS; i++) {
+		bench.measure([&]() {
+			logger->_log_message(p_message, false);
+		});
+	}
+	bench.report();
+}
+
+void _print_header(const char *p_title) {
+	UtilityFunctions::print(String(p_title) + " (SDK enabled: " + (SentrySDK::get_singleton()->is_enabled() ? "yes" : "no") + ")");
+}
+
+} // unnamed namespace
+
+TEST_SUITE("[Benchmark] SentryGodotLogger" * doctest::skip()) {
+	TEST_CASE("_log_error throughput and latency") {
+		ScopedBenchmarkSDK sdk;
+		_print_header("SentryGodotLogger::_log_error");
+
+		{
+			// Same source line every time – rejected by the repeated error window after the first call.
+			LoggerConfig config;
+			config.repeated_error_window_ms = 60'000;
+			_bench_log_error("deduplicated", config, false);
+		}
+		{
+			// Distinct source lines, but over the per-frame and throttling limits after the first few.
+			LoggerConfig config;
+			config.events_per_frame = 5;
+			config.throttle_events = 20;
+			_bench_log_error("throttled", config, true);
+		}
+		{
+			LoggerConfig config;
+			config.event_mask = GodotLoggerEventMask::MASK_NONE;
+			config.breadcrumb_mask = GodotLoggerEventMask::MASK_ALL;
+			_bench_log_error("breadcrumbs only", config, true);
+		}
+		{
+			LoggerConfig config;
+			_bench_log_error("events, no script frames", config, true);
+		}
+		{
+			LoggerConfig config;
+			_bench_log_error_from_script("events, script frames", config);
+		}
+		{
+			LoggerConfig config;
+			config.include_source_context = true;
+			_bench_log_error_from_script("events, with source context", config);
+		}
+		{
+			LoggerConfig config;
+			config.include_variables = true;
+			_bench_log_error_from_script("events, with variables", config);
+		}
+	}
+
+	TEST_CASE("_log_message throughput and latency") {
+		ScopedBenchmarkSDK sdk;
+		_print_header("SentryGodotLogger::_log_message");
+
+		{
+			LoggerConfig config;
+			_bench_log_message("skipped (masks off)", config, "Player spawned at (12, 40)");
+		}
+		{
+			LoggerConfig config;
+			config.breadcrumb_mask = GodotLoggerEventMask::MASK_ALL;
+			_bench_log_message("breadcrumbs", config, "Player spawned at (12, 40)");
+		}
+		{
+			LoggerConfig config;
+			config.breadcrumb_mask = GodotLoggerEventMask::MASK_ALL;
+			_bench_log_message("breadcrumbs, ANSI escapes", config, "\u001b[1;33mPlayer spawned\u001b[0m at (12, 40)");
+		}
+		{
+			LoggerConfig config;
+			config.log_mask = GodotLoggerEventMask::MASK_ALL;
+			_bench_log_message("structured logs", config, "Player spawned at (12, 40)");
+		}
+		{
+			LoggerConfig config;
+			config.breadcrumb_mask = GodotLoggerEventMask::MASK_ALL;
+			_bench_log_message("filtered by prefix", config, "Sentry: DEBUG: benchmark message");
+		}
+	}
+}
+
+#endif // BENCHMARKS_ENABLED
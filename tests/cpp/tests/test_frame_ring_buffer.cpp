@@ -0,0 +1,90 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/util/frame_ring_buffer.h"
+
+#include <doctest.h>
+
+using namespace godot;
+using sentry::util::FrameRingBuffer;
+
+namespace {
+
+Ref<Image> make_frame(int p_width, int p_height, const Color &p_color, Image::Format p_format = Image::FORMAT_RGBA8) {
+	Ref<Image> image = Image::create_empty(p_width, p_height, false, p_format);
+	image->fill(p_color);
+	return image;
+}
+
+} // unnamed namespace
+
+TEST_SUITE("[Util] FrameRingBuffer") {
+	TEST_CASE("Downscales frames preserving aspect ratio") {
+		FrameRingBuffer frames;
+		frames.init(4, 100);
+		frames.push(make_frame(400, 200, Color(1, 0, 0)));
+
+		CHECK(frames.get_count() == 1);
+		CHECK(frames.get_frame_width() == 100);
+		CHECK(frames.get_frame_height() == 50);
+	}
+
+	TEST_CASE("Keeps frames that are already downscaled") {
+		FrameRingBuffer frames;
+		frames.init(4, 100);
+		Vector2i frame_size = frames.get_frame_size_for(1920, 1080);
+		CHECK(frame_size == Vector2i(100, 56));
+
+		// Frames downscaled on the GPU are stored at the same size.
+		frames.push(make_frame(frame_size.x, frame_size.y, Color(1, 0, 0)));
+		CHECK(frames.get_frame_width() == frame_size.x);
+		CHECK(frames.get_frame_height() == frame_size.y);
+	}
+
+	TEST_CASE("Caps preallocated memory") {
+		FrameRingBuffer frames;
+		frames.init(64, 1920);
+		CHECK(frames.get_capacity() == int(FrameRingBuffer::MAX_TOTAL_BYTES / (1920 * 1920 * 3)));
+
+		frames.init(8, 100);
+		CHECK(frames.get_capacity() == 8);
+	}
+
+	TEST_CASE("Keeps only the most recent frames, oldest first") {
+		FrameRingBuffer frames;
+		frames.init(3, 8);
+		const Color colors[] = { Color(1, 0, 0), Color(0, 1, 0), Color(0, 0, 1), Color(1, 1, 1) };
+		for (const Color &color : colors) {
+			frames.push(make_frame(8, 8, color, Image::FORMAT_RGB8));
+		}
+		CHECK(frames.get_count() == 3);
+
+		// 3 frames in a 2x2 grid, the last cell stays empty.
+		Ref<Image> sheet = frames.make_contact_sheet();
+		REQUIRE(sheet.is_valid());
+		CHECK(sheet->get_width() == 16);
+		CHECK(sheet->get_height() == 16);
+		CHECK(sheet->get_pixel(0, 0) == Color(0, 1, 0));
+		CHECK(sheet->get_pixel(8, 0) == Color(0, 0, 1));
+		CHECK(sheet->get_pixel(0, 8) == Color(1, 1, 1));
+		CHECK(sheet->get_pixel(8, 8) == Color(0, 0, 0));
+	}
+
+	TEST_CASE("Resets when source resolution changes") {
+		FrameRingBuffer frames;
+		frames.init(2, 64);
+		frames.push(make_frame(32, 32, Color(1, 0, 0)));
+		frames.push(make_frame(64, 32, Color(0, 1, 0)));
+
+		CHECK(frames.get_count() == 1);
+		CHECK(frames.get_frame_width() == 64);
+		CHECK(frames.get_frame_height() == 32);
+	}
+
+	TEST_CASE("Empty buffer produces no image") {
+		FrameRingBuffer frames;
+		frames.init(2, 64);
+		CHECK(frames.make_contact_sheet().is_null());
+	}
+}
+
+#endif // TESTS_ENABLED
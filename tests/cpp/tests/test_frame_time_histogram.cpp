@@ -0,0 +1,59 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/util/frame_time_histogram.h"
+
+#include <doctest.h>
+
+using sentry::util::FrameTimeHistogram;
+
+TEST_SUITE("[Util] FrameTimeHistogram") {
+	TEST_CASE("Buckets are contiguous and bound their values") {
+		CHECK(FrameTimeHistogram::get_bucket_index(0) == 0);
+		CHECK(FrameTimeHistogram::get_bucket_index(31) == 31);
+		CHECK(FrameTimeHistogram::get_bucket_index(32) == 32);
+		CHECK(FrameTimeHistogram::get_bucket_index(FrameTimeHistogram::MAX_VALUE_USEC) == FrameTimeHistogram::BUCKET_COUNT - 1);
+		CHECK(FrameTimeHistogram::get_bucket_index(UINT64_MAX) == FrameTimeHistogram::BUCKET_COUNT - 1);
+
+		for (int i = 1; i < FrameTimeHistogram::BUCKET_COUNT; i++) {
+			CHECK(FrameTimeHistogram::get_bucket_lower_bound(i) == FrameTimeHistogram::get_bucket_upper_bound(i - 1));
+		}
+		for (uint64_t value : { 1ull, 33ull, 1000ull, 16667ull, 100000ull, 5000000ull }) {
+			int index = FrameTimeHistogram::get_bucket_index(value);
+			CHECK(FrameTimeHistogram::get_bucket_lower_bound(index) <= value);
+			CHECK(FrameTimeHistogram::get_bucket_upper_bound(index) > value);
+		}
+	}
+
+	TEST_CASE("Estimates percentiles") {
+		FrameTimeHistogram histogram;
+		CHECK(histogram.get_value_at_percentile(50.0) == 0.0);
+
+		// 90 frames at ~16.7 ms, 9 at 33 ms and one 250 ms hitch.
+		for (int i = 0; i < 90; i++) {
+			histogram.record(16667);
+		}
+		for (int i = 0; i < 9; i++) {
+			histogram.record(33000);
+		}
+		histogram.record(250000);
+
+		CHECK(histogram.get_count() == 100);
+		CHECK(histogram.get_max() == 250000);
+		CHECK(histogram.get_value_at_percentile(50.0) == doctest::Approx(16667).epsilon(0.03));
+		CHECK(histogram.get_value_at_percentile(95.0) == doctest::Approx(33000).epsilon(0.03));
+		CHECK(histogram.get_value_at_percentile(100.0) == doctest::Approx(250000).epsilon(0.03));
+		CHECK(histogram.get_value_at_percentile(100.0) <= 250000);
+	}
+
+	TEST_CASE("Reset clears recorded values") {
+		FrameTimeHistogram histogram;
+		histogram.record(1000);
+		histogram.reset();
+
+		CHECK(histogram.get_count() == 0);
+		CHECK(histogram.get_max() == 0);
+		CHECK(histogram.get_value_at_percentile(99.0) == 0.0);
+	}
+}
+
+#endif // TESTS_ENABLED
@@ -0,0 +1,220 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/util/json_writer.h"
+
+#include <doctest.h>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/marshalls.hpp>
+#include <string>
+
+using namespace godot;
+using sentry::util::JSONWriter;
+
+TEST_SUITE("[Util] JSONWriter") {
+	TEST_CASE("Writes nested objects and arrays") {
+		JSONWriter jw;
+		jw.begin_object();
+		jw.kv_string("name", "test");
+		jw.kv_int("count", -42);
+		jw.kv_bool("enabled", true);
+		jw.key("items");
+		jw.begin_array();
+		jw.value_int(1);
+		jw.value_null();
+		jw.begin_object();
+		jw.end_object();
+		jw.end_array();
+		jw.end_object();
+
+		CHECK(std::string(jw.get_utf8()) == R"({"name":"test","count":-42,"enabled":true,"items":[1,null,{}]})");
+		CHECK(jw.get_string() == R"({"name":"test","count":-42,"enabled":true,"items":[1,null,{}]})");
+	}
+
+	TEST_CASE("Escapes strings") {
+		JSONWriter jw;
+		jw.begin_array();
+		jw.value_string(String("quote\" backslash\\ newline\n tab\t"));
+		jw.value_string(String("bell") + String::chr(0x07));
+		jw.value_string("literal \"key\"");
+		jw.end_array();
+
+		CHECK(std::string(jw.get_utf8()) == R"(["quote\" backslash\\ newline\n tab\t","bell\u0007","literal \"key\""])");
+	}
+
+	TEST_CASE("Encodes UTF-8") {
+		JSONWriter jw;
+		jw.value_string(String::utf8("é こんにちは 🌍"));
+
+		CHECK(std::string(jw.get_utf8()) == "\"é こんにちは 🌍\"");
+		CHECK(jw.get_string() == String::utf8("\"é こんにちは 🌍\""));
+	}
+
+	TEST_CASE("Formats numbers") {
+		JSONWriter jw;
+		jw.begin_array();
+		jw.value_int(INT64_MIN);
+		jw.value_float(3.0);
+		jw.value_float(0.1);
+		jw.value_float(-2.5);
+		jw.value_float(1e300);
+		jw.value_float(NAN);
+		jw.value_float(INFINITY);
+		jw.end_array();
+
+		// Parse back with Godot's JSON to be independent of exact float formatting.
+		Variant parsed = JSON::parse_string(jw.get_string());
+		REQUIRE(parsed.get_type() == Variant::ARRAY);
+		Array arr = parsed;
+		REQUIRE(arr.size() == 7);
+		CHECK(String(jw.get_utf8()).begins_with("[-9223372036854775808,3,"));
+		CHECK(double(arr[2]) == 0.1);
+		CHECK(double(arr[3]) == -2.5);
+		CHECK(double(arr[4]) == doctest::Approx(1e300));
+		CHECK(arr[5].get_type() == Variant::NIL);
+		CHECK(arr[6].get_type() == Variant::NIL);
+	}
+
+	TEST_CASE("Writes packed numeric arrays") {
+		PackedInt32Array ints = { -1, 0, 2147483647 };
+		PackedFloat32Array floats = { 0.1f, 3.0f, -2.5f };
+		PackedByteArray bytes = { 0, 128, 255 };
+
+		JSONWriter jw;
+		jw.begin_array();
+		jw.value_variant(ints);
+		jw.value_variant(floats);
+		jw.value_variant(bytes);
+		jw.value_variant(PackedFloat64Array());
+		jw.end_array();
+
+		CHECK(std::string(jw.get_utf8()) == "[[-1,0,2147483647],[0.1,3,-2.5],[0,128,255],[]]");
+	}
+
+	TEST_CASE("Writes large packed arrays across blocks") {
+		PackedInt64Array values;
+		values.resize(5000);
+		for (int i = 0; i < values.size(); i++) {
+			values.set(i, i);
+		}
+
+		JSONWriter jw;
+		jw.value_int64_array(values);
+
+		Variant parsed = JSON::parse_string(jw.get_string());
+		REQUIRE(parsed.get_type() == Variant::ARRAY);
+		Array arr = parsed;
+		REQUIRE(arr.size() == 5000);
+		CHECK(int64_t(arr[0]) == 0);
+		CHECK(int64_t(arr[1024]) == 1024);
+		CHECK(int64_t(arr[4999]) == 4999);
+	}
+
+	TEST_CASE("Writes vector and color arrays as strings") {
+		PackedVector2Array vectors = { Vector2(1, 2.5), Vector2(-0.25, 0) };
+		PackedColorArray colors = { Color(1, 0, 0.5, 1) };
+
+		JSONWriter jw;
+		jw.begin_array();
+		jw.value_vector2_array(vectors);
+		jw.value_color_array(colors);
+		jw.end_array();
+
+		CHECK(std::string(jw.get_utf8()) == R"([["(1.0, 2.5)","(-0.25, 0.0)"],["(1.0, 0.0, 0.5, 1.0)"]])");
+	}
+
+	TEST_CASE("Writes byte arrays as base64") {
+		JSONWriter jw;
+		jw.set_bytes_as_base64(true);
+		jw.begin_array();
+		jw.value_byte_array(String("Man").to_utf8_buffer());
+		jw.value_byte_array(String("Ma").to_utf8_buffer());
+		jw.value_byte_array(String("M").to_utf8_buffer());
+		jw.value_byte_array(PackedByteArray());
+		jw.end_array();
+
+		CHECK(std::string(jw.get_utf8()) == R"(["TWFu","TWE=","TQ==",""])");
+
+		PackedByteArray data;
+		data.resize(10000);
+		for (int i = 0; i < data.size(); i++) {
+			data.set(i, uint8_t(i * 7));
+		}
+		JSONWriter jw_large;
+		jw_large.set_bytes_as_base64(true);
+		jw_large.value_byte_array(data);
+		CHECK(jw_large.get_string() == "\"" + Marshalls::get_singleton()->raw_to_base64(data) + "\"");
+	}
+
+	TEST_CASE("Limits number of array elements") {
+		JSONWriter jw;
+		jw.set_max_array_elements(2);
+		jw.begin_array();
+		jw.value_int32_array(PackedInt32Array({ 1, 2, 3 }));
+		jw.value_string_array(PackedStringArray({ "a", "b", "c" }));
+		jw.value_array(Array::make(1, 2, 3));
+		jw.end_array();
+
+		CHECK(std::string(jw.get_utf8()) == R"([[1,2],["a","b"],[1,2]])");
+	}
+
+	TEST_CASE("Writes dictionaries") {
+		Dictionary inner;
+		inner["bytes"] = String("Man").to_utf8_buffer();
+		Dictionary dict;
+		dict["name"] = "test";
+		dict[StringName("inner")] = inner;
+		dict[1] = Array::make(true, Variant());
+
+		JSONWriter jw;
+		jw.set_bytes_as_base64(true);
+		jw.value_dictionary(dict);
+		CHECK(std::string(jw.get_utf8()) == R"({"name":"test","inner":{"bytes":"TWFu"},"1":[true,null]})");
+	}
+
+	TEST_CASE("Limits nesting depth") {
+		Variant nested = Array();
+		for (int i = 0; i < 40; i++) {
+			nested = Array::make(nested);
+		}
+
+		JSONWriter jw;
+		jw.value_variant(nested);
+		std::string expected = std::string(32, '[') + R"("[...]")" + std::string(32, ']');
+		CHECK(std::string(jw.get_utf8()) == expected);
+	}
+
+	TEST_CASE("Streams to sink") {
+		std::string output;
+		JSONWriter jw([&output](const char *p_data, size_t p_size) {
+			output.append(p_data, p_size);
+			return true;
+		});
+
+		jw.begin_array();
+		for (int i = 0; i < 10000; i++) {
+			jw.value_string("element");
+		}
+		jw.end_array();
+
+		CHECK_FALSE(output.empty()); // flushed while writing
+		CHECK(jw.flush());
+		CHECK(output.size() == 2 + 10000 * 10 - 1);
+		CHECK(output.rfind("[\"element\",\"element\"", 0) == 0);
+		CHECK(output.back() == ']');
+	}
+
+	TEST_CASE("Stops writing when sink fails") {
+		int calls = 0;
+		JSONWriter jw([&calls](const char *p_data, size_t p_size) {
+			calls++;
+			return false;
+		});
+
+		jw.value_string("data");
+		CHECK_FALSE(jw.flush());
+		CHECK_FALSE(jw.flush());
+		CHECK(calls == 1);
+	}
+}
+
+#endif // TESTS_ENABLED
@@ -0,0 +1,125 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/logging/log_batcher.h"
+
+#include <doctest.h>
+#include <thread>
+#include <vector>
+
+using namespace godot;
+using sentry::logging::LogBatcher;
+
+namespace {
+
+LogBatcher::Record make_record(const String &p_body, double p_timestamp = 0.0) {
+	LogBatcher::Record record;
+	record.timestamp = p_timestamp;
+	record.body = p_body;
+	return record;
+}
+
+std::vector<String> flush(LogBatcher &p_batcher, bool p_skip_locked = false) {
+	std::vector<String> bodies;
+	auto capture = [&bodies](const LogBatcher::Record &p_record) {
+		bodies.push_back(p_record.body);
+	};
+	p_batcher.flush(capture, p_skip_locked);
+	return bodies;
+}
+
+} // unnamed namespace
+
+TEST_SUITE("[Logging] LogBatcher") {
+	TEST_CASE("Flushes logs in order") {
+		LogBatcher batcher;
+		batcher.set_batch_size(10);
+		for (int i = 0; i < 5; i++) {
+			CHECK_FALSE(batcher.append(make_record(itos(i))));
+		}
+		CHECK_FALSE(batcher.is_empty());
+
+		std::vector<String> bodies = flush(batcher);
+		REQUIRE(bodies.size() == 5);
+		for (int i = 0; i < 5; i++) {
+			CHECK(bodies[i] == itos(i));
+		}
+		CHECK(batcher.is_empty());
+		CHECK(flush(batcher).empty());
+	}
+
+	TEST_CASE("Signals full batch") {
+		LogBatcher batcher;
+		batcher.set_batch_size(3);
+		CHECK_FALSE(batcher.append(make_record("a")));
+		CHECK_FALSE(batcher.append(make_record("b")));
+		CHECK(batcher.append(make_record("c")));
+
+		// Full batch is flushed without waiting for the interval.
+		CHECK(batcher.try_start_flush(1000, 100));
+		CHECK(flush(batcher).size() == 3);
+
+		CHECK_FALSE(batcher.append(make_record("d")));
+		CHECK_FALSE(batcher.try_start_flush(1010, 100));
+		CHECK(batcher.try_start_flush(1100, 100));
+		CHECK(flush(batcher).size() == 1);
+	}
+
+	TEST_CASE("Drops oldest logs when full") {
+		LogBatcher batcher;
+		batcher.set_batch_size(2);
+		const int capacity = 2 * LogBatcher::CAPACITY_FACTOR;
+		for (int i = 0; i < capacity + 3; i++) {
+			batcher.append(make_record(itos(i)));
+		}
+		CHECK(batcher.get_dropped_count() == 3);
+		CHECK(batcher.take_unreported_dropped_count() == 3);
+		CHECK(batcher.take_unreported_dropped_count() == 0);
+
+		std::vector<String> bodies = flush(batcher);
+		REQUIRE(bodies.size() == capacity);
+		CHECK(bodies.front() == "3");
+		CHECK(bodies.back() == itos(capacity + 2));
+	}
+
+	TEST_CASE("Flushes logs from all threads in timestamp order") {
+		LogBatcher batcher;
+		batcher.set_batch_size(10);
+		batcher.append(make_record("b", 2.0));
+		std::thread other([&batcher]() {
+			batcher.append(make_record("a", 1.0));
+			batcher.append(make_record("d", 4.0));
+		});
+		other.join();
+		batcher.append(make_record("c", 3.0));
+
+		std::vector<String> bodies = flush(batcher);
+		REQUIRE(bodies.size() == 4);
+		CHECK(bodies[0] == "a");
+		CHECK(bodies[1] == "b");
+		CHECK(bodies[2] == "c");
+		CHECK(bodies[3] == "d");
+	}
+
+	TEST_CASE("Keeps append order for equal timestamps") {
+		LogBatcher batcher;
+		batcher.set_batch_size(10);
+		for (int i = 0; i < 5; i++) {
+			batcher.append(make_record(itos(i), 1.0));
+		}
+		std::vector<String> bodies = flush(batcher, true);
+		REQUIRE(bodies.size() == 5);
+		for (int i = 0; i < 5; i++) {
+			CHECK(bodies[i] == itos(i));
+		}
+	}
+
+	TEST_CASE("Flush interval") {
+		LogBatcher batcher;
+		CHECK_FALSE(batcher.try_start_flush(1000, 100));
+		CHECK_FALSE(batcher.try_start_flush(1050, 100));
+		CHECK(batcher.try_start_flush(1100, 100));
+		CHECK_FALSE(batcher.try_start_flush(1150, 100));
+	}
+}
+
+#endif // TESTS_ENABLED
@@ -0,0 +1,127 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/logging/log_rate_limiter.h"
+
+#include <doctest.h>
+#include <vector>
+
+using namespace godot;
+using sentry::LOG_LEVEL_ERROR;
+using sentry::LOG_LEVEL_INFO;
+using sentry::LOG_LEVEL_WARN;
+using sentry::logging::LogRateLimiter;
+
+namespace {
+
+constexpr uint64_t SECOND_USEC = 1'000'000;
+
+Dictionary make_limits() {
+	Dictionary limits;
+	limits["info"] = 5;
+	limits["warn"] = 10;
+	return limits;
+}
+
+int count_allowed(LogRateLimiter &p_limiter, sentry::LogLevel p_level, const String &p_origin, int p_attempts, uint64_t p_now_usec) {
+	int allowed = 0;
+	for (int i = 0; i < p_attempts; i++) {
+		allowed += p_limiter.try_acquire(p_level, p_origin, "Enemy not found", p_now_usec) ? 1 : 0;
+	}
+	return allowed;
+}
+
+} // unnamed namespace
+
+TEST_SUITE("[Logging] LogRateLimiter") {
+	TEST_CASE("Disabled without limits") {
+		LogRateLimiter limiter;
+		limiter.configure(Dictionary());
+		CHECK_FALSE(limiter.is_enabled());
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 1000, SECOND_USEC) == 1000);
+	}
+
+	TEST_CASE("Limits each level and origin separately") {
+		LogRateLimiter limiter;
+		limiter.configure(make_limits());
+		REQUIRE(limiter.is_enabled());
+
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 100, SECOND_USEC) == 5);
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "auto.log.godot", 100, SECOND_USEC) == 5);
+		CHECK(count_allowed(limiter, LOG_LEVEL_WARN, "manual", 100, SECOND_USEC) == 10);
+		// No limit configured for errors.
+		CHECK(count_allowed(limiter, LOG_LEVEL_ERROR, "manual", 100, SECOND_USEC) == 100);
+	}
+
+	TEST_CASE("Refills over time") {
+		LogRateLimiter limiter;
+		limiter.configure(make_limits());
+
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 5, SECOND_USEC) == 5);
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 5, SECOND_USEC) == 0);
+
+		// After a second, the summary of suppressed logs takes one log from the budget.
+		std::vector<LogRateLimiter::Summary> summaries;
+		limiter.take_summaries(2 * SECOND_USEC, false, summaries);
+		CHECK(summaries.size() == 1);
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 5, 2 * SECOND_USEC) == 4);
+	}
+
+	TEST_CASE("Allows slow rates while a summary is pending") {
+		LogRateLimiter limiter;
+		Dictionary limits;
+		limits["info"] = 1.0;
+		limiter.configure(limits);
+
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 2, SECOND_USEC) == 1);
+		REQUIRE(limiter.has_suppressed_logs());
+
+		// Without taking the summary, the bucket still fills up to make room for both the summary and the log.
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 1, 2 * SECOND_USEC) == 0);
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 1, 3 * SECOND_USEC) == 1);
+
+		std::vector<LogRateLimiter::Summary> summaries;
+		limiter.take_summaries(3 * SECOND_USEC, false, summaries);
+		REQUIRE(summaries.size() == 1);
+		CHECK(summaries[0].count == 2);
+	}
+
+	TEST_CASE("Summarizes suppressed logs") {
+		LogRateLimiter limiter;
+		limiter.configure(make_limits());
+
+		CHECK(count_allowed(limiter, LOG_LEVEL_INFO, "manual", 47, SECOND_USEC) == 5);
+		REQUIRE(limiter.has_suppressed_logs());
+
+		// Bucket is still empty.
+		std::vector<LogRateLimiter::Summary> summaries;
+		limiter.take_summaries(SECOND_USEC, false, summaries);
+		CHECK(summaries.empty());
+
+		limiter.take_summaries(2 * SECOND_USEC, false, summaries);
+		REQUIRE(summaries.size() == 1);
+		CHECK(summaries[0].level == LOG_LEVEL_INFO);
+		CHECK(summaries[0].origin == "manual");
+		CHECK(summaries[0].body == "Enemy not found");
+		CHECK(summaries[0].count == 42);
+		CHECK(summaries[0].same_body);
+		CHECK_FALSE(limiter.has_suppressed_logs());
+	}
+
+	TEST_CASE("Tracks whether suppressed bodies differ") {
+		LogRateLimiter limiter;
+		limiter.configure(make_limits());
+
+		count_allowed(limiter, LOG_LEVEL_INFO, "manual", 5, SECOND_USEC);
+		CHECK_FALSE(limiter.try_acquire(LOG_LEVEL_INFO, "manual", "first", SECOND_USEC));
+		CHECK_FALSE(limiter.try_acquire(LOG_LEVEL_INFO, "manual", "second", SECOND_USEC));
+
+		std::vector<LogRateLimiter::Summary> summaries;
+		limiter.take_summaries(SECOND_USEC, true, summaries);
+		REQUIRE(summaries.size() == 1);
+		CHECK(summaries[0].body == "first");
+		CHECK(summaries[0].count == 2);
+		CHECK_FALSE(summaries[0].same_body);
+	}
+}
+
+#endif // TESTS_ENABLED
@@ -0,0 +1,107 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/logging/message_filter.h"
+
+#include <doctest.h>
+
+using namespace godot;
+using sentry::logging::MessageFilter;
+
+namespace {
+
+MessageFilter make_filter(std::initializer_list<const char *> p_patterns) {
+	PackedStringArray patterns;
+	for (const char *pattern : p_patterns) {
+		patterns.append(pattern);
+	}
+	MessageFilter filter;
+	filter.compile(patterns);
+	return filter;
+}
+
+} // unnamed namespace
+
+TEST_SUITE("[Logging] MessageFilter") {
+	TEST_CASE("Empty filter matches nothing") {
+		MessageFilter filter = make_filter({});
+		CHECK(filter.is_empty());
+		CHECK_FALSE(filter.matches(""));
+		CHECK_FALSE(filter.matches("Hello"));
+	}
+
+	TEST_CASE("Prefix, suffix, substring and exact patterns") {
+		MessageFilter filter = make_filter({ "Sentry: *", "*.tmp", "*deprecated*", "Exactly this" });
+		CHECK(filter.matches("Sentry: Initialized"));
+		CHECK(filter.matches("Sentry: "));
+		CHECK_FALSE(filter.matches("Not Sentry: message"));
+
+		CHECK(filter.matches("Removed file.tmp"));
+		CHECK_FALSE(filter.matches("file.tmp removed"));
+
+		CHECK(filter.matches("This API is deprecated, use another one"));
+		CHECK(filter.matches("deprecated"));
+
+		CHECK(filter.matches("Exactly this"));
+		CHECK_FALSE(filter.matches("Exactly this!"));
+		CHECK_FALSE(filter.matches("Not Exactly this"));
+
+		CHECK_FALSE(filter.matches("Unrelated message"));
+	}
+
+	TEST_CASE("Overlapping literals") {
+		// Keys that are suffixes of each other share failure links.
+		MessageFilter filter = make_filter({ "abcd*", "*bc", "*c*" });
+		CHECK(filter.matches("abcd"));
+		CHECK(filter.matches("xbc"));
+		CHECK(filter.matches("xxcxx"));
+		CHECK_FALSE(filter.matches("abd"));
+
+		MessageFilter prefix_only = make_filter({ "aab*" });
+		CHECK(prefix_only.matches("aab"));
+		CHECK_FALSE(prefix_only.matches("aaab"));
+	}
+
+	TEST_CASE("Glob patterns") {
+		MessageFilter filter = make_filter({ "Loading ?? assets*", "[*] Frame * done" });
+		CHECK(filter.matches("Loading 42 assets from disk"));
+		CHECK_FALSE(filter.matches("Loading 420 assets"));
+		CHECK(filter.matches("[Renderer] Frame 10 done"));
+		CHECK_FALSE(filter.matches("[Renderer] Frame 10 done!"));
+	}
+
+	TEST_CASE("Patterns without literals") {
+		CHECK(make_filter({ "*" }).matches("anything"));
+		CHECK(make_filter({ "**" }).matches(""));
+		MessageFilter filter = make_filter({ "???" });
+		CHECK(filter.matches("abc"));
+		CHECK_FALSE(filter.matches("ab"));
+	}
+
+	TEST_CASE("Results agree with String::match for many rules") {
+		PackedStringArray patterns;
+		for (int i = 0; i < 100; i++) {
+			patterns.append(vformat("[Module%d]*", i));
+			patterns.append(vformat("*error code %d", i));
+		}
+		MessageFilter filter;
+		filter.compile(patterns);
+
+		const char *messages[] = {
+			"[Module7] started",
+			"[Module100] started",
+			"Something failed with error code 42",
+			"Something failed with error code 420",
+			"error code 9",
+			"Module7",
+		};
+		for (const char *message : messages) {
+			bool expected = false;
+			for (const String &pattern : patterns) {
+				expected = expected || String(message).match(pattern);
+			}
+			CHECK_MESSAGE(filter.matches(message) == expected, message);
+		}
+	}
+}
+
+#endif // TESTS_ENABLED
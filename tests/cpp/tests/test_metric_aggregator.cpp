@@ -0,0 +1,127 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/metric_aggregator.h"
+#include "sentry/sentry_attributes.h"
+
+#include <doctest.h>
+#include <vector>
+
+using namespace godot;
+using sentry::MetricAggregator;
+using sentry::SentryAttributes;
+using sentry::SentryMetric;
+
+namespace {
+
+struct EmittedMetric {
+	SentryMetric::MetricType type;
+	String name;
+	String unit;
+	Dictionary attributes;
+	int64_t count_value;
+	double value;
+};
+
+std::vector<EmittedMetric> flush(MetricAggregator &p_aggregator) {
+	std::vector<EmittedMetric> emitted;
+	p_aggregator.flush([&emitted](const MetricAggregator::Item &p_item) {
+		emitted.push_back({ p_item.type, p_item.name, p_item.unit, p_item.attributes, p_item.count_value, p_item.value });
+	});
+	return emitted;
+}
+
+} // unnamed namespace
+
+TEST_SUITE("[Metrics] MetricAggregator") {
+	TEST_CASE("Sums counters with the same attributes") {
+		MetricAggregator aggregator;
+		Dictionary castle;
+		castle["level"] = "castle";
+		Dictionary forest;
+		forest["level"] = "forest";
+
+		for (int i = 0; i < 100; i++) {
+			CHECK(aggregator.add_count("enemies_spawned", 2, castle, SentryAttributes::hash_dictionary(castle)));
+		}
+		// Equal attributes in different dictionaries are aggregated together.
+		for (int i = 0; i < 2; i++) {
+			Dictionary copy = forest.duplicate();
+			CHECK(aggregator.add_count("enemies_spawned", 5, copy, SentryAttributes::hash_dictionary(copy)));
+		}
+
+		std::vector<EmittedMetric> emitted = flush(aggregator);
+		REQUIRE(emitted.size() == 2);
+		for (const EmittedMetric &metric : emitted) {
+			CHECK(metric.type == SentryMetric::METRIC_COUNTER);
+			CHECK(metric.name == "enemies_spawned");
+			if (metric.attributes["level"] == Variant("castle")) {
+				CHECK(metric.count_value == 200);
+			} else {
+				CHECK(metric.count_value == 10);
+			}
+		}
+		CHECK(aggregator.is_empty());
+	}
+
+	TEST_CASE("Keeps last gauge value per unit") {
+		MetricAggregator aggregator;
+		aggregator.add_gauge("memory", 1.0, "byte", Dictionary(), 0);
+		aggregator.add_gauge("memory", 3.0, "byte", Dictionary(), 0);
+		aggregator.add_gauge("memory", 2.0, "byte", Dictionary(), 0);
+		aggregator.add_gauge("memory", 2.0, "kilobyte", Dictionary(), 0);
+
+		std::vector<EmittedMetric> emitted = flush(aggregator);
+		REQUIRE(emitted.size() == 2);
+		for (const EmittedMetric &metric : emitted) {
+			CHECK(metric.type == SentryMetric::METRIC_GAUGE);
+			CHECK(metric.value == 2.0);
+			if (metric.unit == "byte") {
+				CHECK(metric.attributes[MetricAggregator::ATTRIBUTE_COUNT] == Variant(3));
+				CHECK(metric.attributes[MetricAggregator::ATTRIBUTE_MIN] == Variant(1.0));
+				CHECK(metric.attributes[MetricAggregator::ATTRIBUTE_MAX] == Variant(3.0));
+			}
+		}
+	}
+
+	TEST_CASE("Summarizes distribution values") {
+		MetricAggregator aggregator;
+		Dictionary attributes;
+		attributes["level"] = "castle";
+		for (int i = 1; i <= 100000; i++) {
+			CHECK(aggregator.add_distribution("load_time", i, "millisecond", attributes, SentryAttributes::hash_dictionary(attributes)));
+		}
+		std::vector<EmittedMetric> emitted = flush(aggregator);
+
+		REQUIRE(emitted.size() == 1);
+		const EmittedMetric &metric = emitted[0];
+		CHECK(metric.type == SentryMetric::METRIC_DISTRIBUTION);
+		CHECK(metric.value == 50000.5);
+		CHECK(metric.attributes["level"] == Variant("castle"));
+		CHECK(metric.attributes[MetricAggregator::ATTRIBUTE_COUNT] == Variant(100000));
+		CHECK(metric.attributes[MetricAggregator::ATTRIBUTE_SUM] == Variant(5000050000.0));
+		CHECK(metric.attributes[MetricAggregator::ATTRIBUTE_MIN] == Variant(1.0));
+		CHECK(metric.attributes[MetricAggregator::ATTRIBUTE_MAX] == Variant(100000.0));
+
+		// Caller's attributes are left untouched.
+		CHECK(attributes.size() == 1);
+	}
+
+	TEST_CASE("Rejects metrics when too many keys") {
+		MetricAggregator aggregator;
+		int accepted = 0;
+		for (int i = 0; i < MetricAggregator::SHARD_COUNT * MetricAggregator::MAX_KEYS_PER_SHARD + 1; i++) {
+			accepted += aggregator.add_count(vformat("metric_%d", i), 1, Dictionary(), 0) ? 1 : 0;
+		}
+		CHECK(accepted < MetricAggregator::SHARD_COUNT * MetricAggregator::MAX_KEYS_PER_SHARD + 1);
+	}
+
+	TEST_CASE("Flush interval") {
+		MetricAggregator aggregator;
+		CHECK_FALSE(aggregator.try_start_flush(1000, 500));
+		CHECK_FALSE(aggregator.try_start_flush(1400, 500));
+		CHECK(aggregator.try_start_flush(1500, 500));
+		CHECK_FALSE(aggregator.try_start_flush(1600, 500));
+	}
+}
+
+#endif // TESTS_ENABLED
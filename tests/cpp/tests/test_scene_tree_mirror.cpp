@@ -0,0 +1,260 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/processing/scene_tree_mirror.h"
+#include "sentry/processing/view_hierarchy_builder.h"
+
+#include <doctest.h>
+#include <godot_cpp/classes/node3d.hpp>
+#include <string>
+
+using namespace godot;
+using sentry::SceneTreeMirror;
+using sentry::ViewHierarchyBuilder;
+
+namespace {
+
+Node *make_node(const String &p_name, Node *p_parent = nullptr) {
+	Node *node = memnew(Node);
+	node->set_name(p_name);
+	if (p_parent) {
+		p_parent->add_child(node);
+	}
+	return node;
+}
+
+std::string to_json(const SceneTreeMirror &p_mirror, const ViewHierarchyBuilder::Limits &p_limits = {}) {
+	ViewHierarchyBuilder builder;
+	builder.set_limits(p_limits);
+	sentry::util::UTF8Buffer buffer = builder.build_json(p_mirror);
+	return buffer.get_size() > 0 ? std::string(buffer.ptr(), buffer.get_size()) : std::string();
+}
+
+} // unnamed namespace
+
+TEST_SUITE("[Processing] SceneTreeMirror") {
+	TEST_CASE("Mirrors existing tree") {
+		Node *root = make_node("Root");
+		make_node("A", root);
+		Node *b = make_node("B", root);
+		Node3D *c = memnew(Node3D);
+		c->set_name("C");
+		b->add_child(c);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		CHECK(mirror.size() == 4);
+		CHECK(to_json(mirror) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[)"
+								 R"({"name":"A","class":"Node"},{"name":"B","class":"Node","children":[{"name":"C","class":"Node3D"}]}]}]})");
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Tracks added, renamed and removed nodes") {
+		Node *root = make_node("Root");
+		Node *a = make_node("A", root);
+		Node *b = make_node("B", root);
+		make_node("C", b);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		// Insert before A.
+		Node *d = make_node("D");
+		root->add_child(d);
+		root->move_child(d, 0);
+		mirror.add_node(d);
+
+		a->set_name("A2");
+		mirror.rename_node(a);
+
+		// Node is still in the tree when node_removed is emitted.
+		mirror.remove_node(b);
+		root->remove_child(b);
+		memdelete(b);
+
+		CHECK(mirror.size() == 3);
+		CHECK(to_json(mirror) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[)"
+								 R"({"name":"D","class":"Node"},{"name":"A2","class":"Node"}]}]})");
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Moves node added again without being removed") {
+		Node *root = make_node("Root");
+		Node *a = make_node("A", root);
+		Node *b = make_node("B", root);
+		Node *c = make_node("C", b);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		// Missed node_removed: the stale entry must be detached from B.
+		b->remove_child(c);
+		a->add_child(c);
+		mirror.add_node(c);
+
+		CHECK(mirror.size() == 4);
+		CHECK(to_json(mirror) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[)"
+								 R"({"name":"A","class":"Node","children":[{"name":"C","class":"Node"}]},{"name":"B","class":"Node"}]}]})");
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Skips internal nodes and their subtrees") {
+		Node *root = make_node("Root");
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		Node *internal = make_node("Internal");
+		root->add_child(internal, false, Node::INTERNAL_MODE_FRONT);
+		mirror.add_node(internal);
+		Node *under_internal = make_node("UnderInternal", internal);
+		mirror.add_node(under_internal);
+		Node *regular = make_node("Regular", root);
+		mirror.add_node(regular);
+
+		CHECK(mirror.size() == 2);
+		CHECK(to_json(mirror) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[{"name":"Regular","class":"Node"}]}]})");
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Escapes names and reuses cached fragments") {
+		Node *root = make_node(String::utf8("Root\\ こんにちは"));
+		make_node("A", root);
+		make_node("B", root);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		const std::string expected = R"({"rendering_system":"Godot","windows":[{"name":"Root\\ こんにちは","class":"Node","children":[)"
+									 R"({"name":"A","class":"Node"},{"name":"B","class":"Node"}]}]})";
+
+		// Second capture is served from the fragment cache.
+		ViewHierarchyBuilder builder;
+		for (int i = 0; i < 2; i++) {
+			sentry::util::UTF8Buffer buffer = builder.build_json(mirror);
+			CHECK(std::string(buffer.ptr(), buffer.get_size()) == expected);
+		}
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Empty mirror produces no output") {
+		SceneTreeMirror mirror;
+		CHECK(to_json(mirror).empty());
+	}
+
+	TEST_CASE("Streams output to a sink in chunks") {
+		Node *root = make_node("Root");
+		for (int i = 0; i < 2000; i++) {
+			make_node(vformat("Node_%d", i), root);
+		}
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		std::string streamed;
+		int chunks = 0;
+		ViewHierarchyBuilder builder;
+		bool ok = builder.write_json(mirror, [&](const char *p_data, size_t p_size) {
+			streamed.append(p_data, p_size);
+			chunks++;
+			return true;
+		});
+
+		CHECK(ok);
+		CHECK(chunks > 1);
+		CHECK(streamed == to_json(mirror));
+
+		// Stops at the first failure.
+		int calls = 0;
+		ok = builder.write_json(mirror, [&](const char *p_data, size_t p_size) {
+			calls++;
+			return false;
+		});
+		CHECK_FALSE(ok);
+		CHECK(calls == 1);
+
+		memdelete(root);
+	}
+}
+
+TEST_SUITE("[Processing] ViewHierarchyBuilder limits") {
+	TEST_CASE("Reports children omitted due to node budget") {
+		Node *root = make_node("Root");
+		Node *a = make_node("A", root);
+		make_node("A1", a);
+		make_node("A2", a);
+		make_node("B", root);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		ViewHierarchyBuilder::Limits limits;
+		limits.max_nodes = 3;
+		CHECK(to_json(mirror, limits) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[)"
+										 R"({"name":"A","class":"Node","children":[{"name":"A1","class":"Node"}],"children_omitted":1}],)"
+										 R"("children_omitted":1}],"truncated":true})");
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Reports children omitted due to depth limit") {
+		Node *root = make_node("Root");
+		Node *a = make_node("A", root);
+		Node *a1 = make_node("A1", a);
+		make_node("Leaf1", a1);
+		make_node("Leaf2", a1);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		ViewHierarchyBuilder::Limits limits;
+		limits.max_depth = 2;
+		CHECK(to_json(mirror, limits) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[)"
+										 R"({"name":"A","class":"Node","children":[{"name":"A1","class":"Node","children_omitted":2}]}]}],"truncated":true})");
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Collapses siblings of the same class") {
+		Node *root = make_node("Root");
+		for (int i = 0; i < 4; i++) {
+			Node3D *node = memnew(Node3D);
+			node->set_name(vformat("Bullet%d", i));
+			root->add_child(node);
+		}
+		make_node("Player", root);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		ViewHierarchyBuilder::Limits limits;
+		limits.collapse_rules.push_back({ "Node3D", 1 });
+		CHECK(to_json(mirror, limits) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[)"
+										 R"({"name":"Bullet0","class":"Node3D"},{"name":"Player","class":"Node"},)"
+										 R"({"name":"(3 more)","class":"Node3D","collapsed_count":3}]}],"truncated":true})");
+
+		memdelete(root);
+	}
+
+	TEST_CASE("Output is unchanged when limits are not reached") {
+		Node *root = make_node("Root");
+		make_node("A", root);
+
+		SceneTreeMirror mirror;
+		mirror.reset(root);
+
+		ViewHierarchyBuilder::Limits limits;
+		limits.max_nodes = 2;
+		limits.max_depth = 1;
+		limits.collapse_rules.push_back({ "Node3D", 0 });
+		CHECK(to_json(mirror, limits) == R"({"rendering_system":"Godot","windows":[{"name":"Root","class":"Node","children":[{"name":"A","class":"Node"}]}]})");
+
+		memdelete(root);
+	}
+}
+
+#endif // TESTS_ENABLED
@@ -0,0 +1,60 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/sentry_attributes.h"
+
+#include <doctest.h>
+
+using namespace godot;
+using sentry::SentryAttributes;
+
+TEST_SUITE("[Metrics] SentryAttributes") {
+	TEST_CASE("Hash doesn't depend on insertion order or name type") {
+		Dictionary a;
+		a["level"] = "castle";
+		a["wave"] = 3;
+		a["boss"] = true;
+
+		Dictionary b;
+		b[StringName("boss")] = true;
+		b["wave"] = 3;
+		b[StringName("level")] = "castle";
+
+		CHECK(SentryAttributes::hash_dictionary(a) != 0);
+		CHECK(SentryAttributes::hash_dictionary(a) == SentryAttributes::hash_dictionary(b));
+
+		// Same hash for the precompiled attributes.
+		CHECK(SentryAttributes::create(b)->get_hash() == SentryAttributes::hash_dictionary(a));
+	}
+
+	TEST_CASE("Hash depends on names, values and types") {
+		Dictionary base;
+		base["wave"] = 3;
+
+		Dictionary other_value;
+		other_value["wave"] = 4;
+
+		Dictionary other_name;
+		other_name["waves"] = 3;
+
+		Dictionary other_type;
+		other_type["wave"] = "3";
+
+		Dictionary swapped;
+		swapped["a"] = "b";
+		Dictionary swapped_back;
+		swapped_back["b"] = "a";
+
+		uint64_t hash = SentryAttributes::hash_dictionary(base);
+		CHECK(hash != SentryAttributes::hash_dictionary(other_value));
+		CHECK(hash != SentryAttributes::hash_dictionary(other_name));
+		CHECK(hash != SentryAttributes::hash_dictionary(other_type));
+		CHECK(SentryAttributes::hash_dictionary(swapped) != SentryAttributes::hash_dictionary(swapped_back));
+	}
+
+	TEST_CASE("Empty attributes hash to zero") {
+		CHECK(SentryAttributes::hash_dictionary(Dictionary()) == 0);
+		CHECK(SentryAttributes::create(Dictionary())->get_hash() == 0);
+	}
+}
+
+#endif // TESTS_ENABLED
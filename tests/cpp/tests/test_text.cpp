@@ -0,0 +1,38 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/util/text.h"
+
+#include <doctest.h>
+
+using namespace godot;
+using sentry::util::strip_invisible;
+
+TEST_SUITE("[Util] Text") {
+	TEST_CASE("strip_invisible returns visible text unchanged") {
+		CHECK(strip_invisible("") == "");
+		CHECK(strip_invisible("Hello") == "Hello");
+		CHECK(strip_invisible("Longer than a single block of sixteen code points") == "Longer than a single block of sixteen code points");
+		CHECK(strip_invisible(String::utf8("UTF-8: こんにちは 🌍")) == String::utf8("UTF-8: こんにちは 🌍"));
+	}
+
+	TEST_CASE("strip_invisible removes control characters") {
+		CHECK(strip_invisible("Hello\n") == "Hello");
+		CHECK(strip_invisible("\tTabbed\r\n") == "Tabbed");
+		CHECK(strip_invisible(String("DEL") + String::chr(0x7F) + "ETE") == "DELETE");
+		CHECK(strip_invisible("\n\n\n") == "");
+		// Control characters past the first SIMD block.
+		CHECK(strip_invisible("0123456789abcdef0123\n456789") == "0123456789abcdef0123456789");
+	}
+
+	TEST_CASE("strip_invisible removes ANSI escape sequences") {
+		String esc = String::chr(0x1B);
+		CHECK(strip_invisible(esc + "[1;33mWarning" + esc + "[0m") == "Warning");
+		CHECK(strip_invisible("Plain " + esc + "[38;5;208mcolored" + esc + "[0m text\n") == "Plain colored text");
+		// Unterminated sequence swallows the rest.
+		CHECK(strip_invisible("Text" + esc + "[123") == "Text");
+		// Lone ESC is just a control character.
+		CHECK(strip_invisible("A" + esc + "B") == "AB");
+	}
+}
+
+#endif // TESTS_ENABLED
@@ -0,0 +1,68 @@
+#ifdef TESTS_ENABLED
+
+#include "sentry/common_defs.h"
+#include "sentry/util/variant_budget.h"
+
+#include <doctest.h>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+using namespace godot;
+using sentry::util::snapshot_variant;
+
+TEST_SUITE("[Util] VariantBudget") {
+	TEST_CASE("snapshot_variant copies containers") {
+		Array inner;
+		inner.append(1);
+		Dictionary dict;
+		dict["inner"] = inner;
+		dict["name"] = "Goblin";
+
+		Dictionary snapshot = snapshot_variant(dict);
+		inner.append(2);
+		dict["name"] = "Orc";
+
+		Array snapshot_inner = snapshot["inner"];
+		CHECK(snapshot_inner.size() == 1);
+		CHECK(snapshot["name"] == Variant("Goblin"));
+	}
+
+	TEST_CASE("snapshot_variant stringifies objects") {
+		Ref<RefCounted> object;
+		object.instantiate();
+		Array array;
+		array.append(object);
+
+		Array snapshot = snapshot_variant(array);
+		REQUIRE(snapshot.size() == 1);
+		CHECK(snapshot[0].get_type() == Variant::STRING);
+		CHECK(snapshot[0] == Variant(Variant(object).stringify()));
+		CHECK(snapshot_variant(object).get_type() == Variant::STRING);
+	}
+
+	TEST_CASE("snapshot_variant keeps to the budgets") {
+		Array array;
+		for (int i = 0; i < sentry::VARIABLE_MAX_ITEMS + 10; i++) {
+			array.append(i);
+		}
+		Array snapshot = snapshot_variant(array);
+		CHECK(snapshot.size() == sentry::VARIABLE_MAX_ITEMS);
+
+		Array nested;
+		Variant value = nested;
+		for (int i = 0; i < sentry::VARIABLE_MAX_DEPTH + 2; i++) {
+			Array outer;
+			outer.append(value);
+			value = outer;
+		}
+		Variant item = snapshot_variant(value);
+		for (int i = 0; i < sentry::VARIABLE_MAX_DEPTH; i++) {
+			REQUIRE(item.get_type() == Variant::ARRAY);
+			item = Array(item)[0];
+		}
+		CHECK(item == Variant("[...]"));
+	}
+}
+
+#endif // TESTS_ENABLED